@@ -34,6 +34,7 @@
 #include <jsoncons/json_type_traits.hpp>
 #include <jsoncons/json_error.hpp>
 #include <jsoncons/detail/heap_only_string.hpp>
+#include <jsoncons/config/binary_config.hpp> // jsoncons::detail::endian
 
 namespace jsoncons {
 
@@ -55,6 +56,20 @@ struct preserve_order_policy : public sorted_policy
     static constexpr bool preserve_order = true;
 };
 
+// Objects keep members in insertion order, with a hash index for lookup
+struct hash_index_policy : public sorted_policy
+{
+    static constexpr bool preserve_order = true;
+    static constexpr bool hash_index = true;
+};
+
+// Values take 8 bytes rather than 16: doubles are stored as themselves, and other values
+// are NaN-boxed, or held on the heap if they do not fit
+struct compact_policy : public sorted_policy
+{
+    static constexpr bool compact = true;
+};
+
 template <typename IteratorT>
 class range 
 {
@@ -89,7 +104,9 @@ enum class storage_type : uint8_t
     byte_string_value = 0x07,
     array_value = 0x08,
     empty_object_value = 0x09,
-    object_value = 0x0a
+    object_value = 0x0a,
+    borrowed_string_value = 0x0b,
+    empty_array_value = 0x0c
 };
 
 template <class CharT, class ImplementationPolicy, class Allocator>
@@ -141,6 +158,8 @@ public:
     typedef typename array::iterator array_iterator;
     typedef typename array::const_iterator const_array_iterator;
 
+    struct empty_array_arg_t {};
+
     struct variant
     {
         class data_base
@@ -199,6 +218,17 @@ public:
             }
         };  
 
+        // Only the empty array is stored inline: an element is itself a 16 byte value
+        // and cannot fit inside one
+        class empty_array_data final : public data_base
+        {
+        public:
+            empty_array_data(semantic_tag tag)
+                : data_base(storage_type::empty_array_value, tag)
+            {
+            }
+        };  
+
         class bool_data final : public data_base
         {
             bool val_;
@@ -369,6 +399,14 @@ public:
                 std::swap(val.ptr_,ptr_);
             }
 
+            // Gives up ownership of the heap data, used by compact_variant
+            pointer release() noexcept
+            {
+                pointer p = ptr_;
+                ptr_ = nullptr;
+                return p;
+            }
+
             const char_type* data() const
             {
                 return ptr_->data();
@@ -390,6 +428,37 @@ public:
             }
         };
 
+        // borrowed_string_data
+        class borrowed_string_data final : public data_base
+        {
+            uint32_t length_;
+            const char_type* data_;
+        public:
+            static const size_t max_length = 0xFFFFFFFF;
+
+            borrowed_string_data(semantic_tag tag, const char_type* data, size_t length)
+                : data_base(storage_type::borrowed_string_value, tag), 
+                  length_(static_cast<uint32_t>(length)), data_(data)
+            {
+                JSONCONS_ASSERT(length <= max_length);
+            }
+
+            borrowed_string_data(const borrowed_string_data& val)
+                : data_base(val.ext_type()), length_(val.length_), data_(val.data_)
+            {
+            }
+
+            const char_type* data() const
+            {
+                return data_;
+            }
+
+            size_t length() const
+            {
+                return length_;
+            }
+        };
+
         // byte_string_data
         class byte_string_data final : public data_base
         {
@@ -456,6 +525,14 @@ public:
                 std::swap(val.ptr_,ptr_);
             }
 
+            // Gives up ownership of the heap data, used by compact_variant
+            pointer release() noexcept
+            {
+                pointer p = ptr_;
+                ptr_ = nullptr;
+                return p;
+            }
+
             const uint8_t* data() const
             {
                 return ptr_->data();
@@ -554,6 +631,14 @@ public:
                 std::swap(val.ptr_,ptr_);
             }
 
+            // Gives up ownership of the heap data, used by compact_variant
+            pointer release() noexcept
+            {
+                pointer p = ptr_;
+                ptr_ = nullptr;
+                return p;
+            }
+
             array& value()
             {
                 return *ptr_;
@@ -633,6 +718,14 @@ public:
                 std::swap(val.ptr_,ptr_);
             }
 
+            // Gives up ownership of the heap data, used by compact_variant
+            pointer release() noexcept
+            {
+                pointer p = ptr_;
+                ptr_ = nullptr;
+                return p;
+            }
+
             object& value()
             {
                 return *ptr_;
@@ -650,8 +743,8 @@ public:
         };
 
     private:
-        static const size_t data_size = static_max<sizeof(uint64_data),sizeof(double_data),sizeof(short_string_data), sizeof(long_string_data), sizeof(array_data), sizeof(object_data)>::value;
-        static const size_t data_align = static_max<alignof(uint64_data),alignof(double_data),alignof(short_string_data),alignof(long_string_data),alignof(array_data),alignof(object_data)>::value;
+        static const size_t data_size = static_max<sizeof(uint64_data),sizeof(double_data),sizeof(short_string_data), sizeof(long_string_data), sizeof(borrowed_string_data), sizeof(array_data), sizeof(object_data)>::value;
+        static const size_t data_align = static_max<alignof(uint64_data),alignof(double_data),alignof(short_string_data),alignof(long_string_data),alignof(borrowed_string_data),alignof(array_data),alignof(object_data)>::value;
 
         typedef typename std::aligned_storage<data_size,data_align>::type data_t;
 
@@ -667,6 +760,11 @@ public:
             new(reinterpret_cast<void*>(&data_))null_data(tag);
         }
 
+        explicit variant(empty_array_arg_t, semantic_tag tag) : data_{}
+        {
+            new(reinterpret_cast<void*>(&data_))empty_array_data(tag);
+        }
+
 		explicit variant(bool val, semantic_tag tag) : data_{}
         {
             new(reinterpret_cast<void*>(&data_))bool_data(val,tag);
@@ -709,6 +807,18 @@ public:
             }
         }
 
+        variant(borrowed_string_arg_t, const char_type* s, size_t length, semantic_tag tag) : data_{}
+        {
+            if (length <= borrowed_string_data::max_length)
+            {
+                new(reinterpret_cast<void*>(&data_))borrowed_string_data(tag, s, length);
+            }
+            else
+            {
+                new(reinterpret_cast<void*>(&data_))long_string_data(tag, s, length, char_allocator_type());
+            }
+        }
+
         variant(const byte_string_view& bs, semantic_tag tag) : data_{}
         {
             new(reinterpret_cast<void*>(&data_))byte_string_data(tag, bs.data(), bs.length(), byte_allocator_type());
@@ -822,6 +932,9 @@ public:
                     case storage_type::null_value:
                         new(reinterpret_cast<void*>(&data_))null_data(*(val.null_data_cast()));
                         break;
+                    case storage_type::empty_array_value:
+                        new(reinterpret_cast<void*>(&data_))empty_array_data(*(val.empty_array_data_cast()));
+                        break;
                     case storage_type::empty_object_value:
                         new(reinterpret_cast<void*>(&data_))empty_object_data(*(val.empty_object_data_cast()));
                         break;
@@ -843,6 +956,9 @@ public:
                     case storage_type::long_string_value:
                         new(reinterpret_cast<void*>(&data_))long_string_data(*(val.string_data_cast()));
                         break;
+                    case storage_type::borrowed_string_value:
+                        new(reinterpret_cast<void*>(&data_))borrowed_string_data(*(val.borrowed_string_data_cast()));
+                        break;
                     case storage_type::byte_string_value:
                         new(reinterpret_cast<void*>(&data_))byte_string_data(*(val.byte_string_data_cast()));
                         break;
@@ -889,6 +1005,11 @@ public:
             return reinterpret_cast<const empty_object_data*>(&data_);
         }
 
+        const empty_array_data* empty_array_data_cast() const
+        {
+            return reinterpret_cast<const empty_array_data*>(&data_);
+        }
+
         const bool_data* bool_data_cast() const
         {
             return reinterpret_cast<const bool_data*>(&data_);
@@ -914,6 +1035,11 @@ public:
             return reinterpret_cast<const short_string_data*>(&data_);
         }
 
+        const borrowed_string_data* borrowed_string_data_cast() const
+        {
+            return reinterpret_cast<const borrowed_string_data*>(&data_);
+        }
+
         long_string_data* string_data_cast()
         {
             return reinterpret_cast<long_string_data*>(&data_);
@@ -975,6 +1101,8 @@ public:
                     return string_view_type(short_string_data_cast()->data(),short_string_data_cast()->length());
                 case storage_type::long_string_value:
                     return string_view_type(string_data_cast()->data(),string_data_cast()->length());
+                case storage_type::borrowed_string_value:
+                    return string_view_type(borrowed_string_data_cast()->data(),borrowed_string_data_cast()->length());
                 default:
                     JSONCONS_THROW(json_runtime_error<std::runtime_error>("Not a string"));
             }
@@ -983,31 +1111,38 @@ public:
         template <typename BAllocator=std::allocator<uint8_t>>
         basic_byte_string<BAllocator> as_byte_string() const
         {
-            switch (type())
+            return to_byte_string<BAllocator>(*this);
+        }
+
+        template <class BAllocator, class V>
+        static basic_byte_string<BAllocator> to_byte_string(const V& val)
+        {
+            switch (val.type())
             {
                 case storage_type::short_string_value:
                 case storage_type::long_string_value:
+                case storage_type::borrowed_string_value:
                 {
-                    switch (tag())
+                    switch (val.tag())
                     {
                         case semantic_tag::base16:
                         {
                             basic_byte_string<BAllocator> bs;
-                            auto s = as_string_view();
+                            auto s = val.as_string_view();
                             decode_base16(s.begin(), s.end(), bs);
                             return bs;
                         }
                         case semantic_tag::base64:
                         {
                             basic_byte_string<BAllocator> bs;
-                            auto s = as_string_view();
+                            auto s = val.as_string_view();
                             decode_base64(s.begin(), s.end(), bs);
                             return bs;
                         }
                         case semantic_tag::base64url:
                         {
                             basic_byte_string<BAllocator> bs;
-                            auto s = as_string_view();
+                            auto s = val.as_string_view();
                             decode_base64url(s.begin(), s.end(), bs);
                             return bs;
                         }
@@ -1017,7 +1152,7 @@ public:
                     break;
                 }
                 case storage_type::byte_string_value:
-                    return basic_byte_string<BAllocator>(byte_string_data_cast()->data(),byte_string_data_cast()->length());
+                    return basic_byte_string<BAllocator>(val.byte_string_data_cast()->data(),val.byte_string_data_cast()->length());
                 default:
                     JSONCONS_THROW(json_runtime_error<std::runtime_error>("Not a byte string"));
             }
@@ -1037,23 +1172,30 @@ public:
         template <class UserAllocator=std::allocator<uint8_t>>
         basic_bignum<UserAllocator> as_bignum() const
         {
-            switch (type())
+            return to_bignum<UserAllocator>(*this);
+        }
+
+        template <class UserAllocator, class V>
+        static basic_bignum<UserAllocator> to_bignum(const V& val)
+        {
+            switch (val.type())
             {
                 case storage_type::short_string_value:
                 case storage_type::long_string_value:
-                    if (!jsoncons::detail::is_integer(as_string_view().data(), as_string_view().length()))
+                case storage_type::borrowed_string_value:
+                    if (!jsoncons::detail::is_integer(val.as_string_view().data(), val.as_string_view().length()))
                     {
                         JSONCONS_THROW(json_runtime_error<std::runtime_error>("Not an integer"));
                     }
-                    return basic_bignum<UserAllocator>(as_string_view().data(), as_string_view().length());
+                    return basic_bignum<UserAllocator>(val.as_string_view().data(), val.as_string_view().length());
                 case storage_type::double_value:
-                    return basic_bignum<UserAllocator>(double_data_cast()->value());
+                    return basic_bignum<UserAllocator>(val.double_data_cast()->value());
                 case storage_type::int64_value:
-                    return basic_bignum<UserAllocator>(int64_data_cast()->value());
+                    return basic_bignum<UserAllocator>(val.int64_data_cast()->value());
                 case storage_type::uint64_value:
-                    return basic_bignum<UserAllocator>(uint64_data_cast()->value());
+                    return basic_bignum<UserAllocator>(val.uint64_data_cast()->value());
                 case storage_type::bool_value:
-                    return basic_bignum<UserAllocator>(bool_data_cast()->value() ? 1 : 0);
+                    return basic_bignum<UserAllocator>(val.bool_data_cast()->value() ? 1 : 0);
                 default:
                     JSONCONS_THROW(json_runtime_error<std::runtime_error>("Not a bignum"));
             }
@@ -1061,11 +1203,18 @@ public:
 
         bool operator==(const variant& rhs) const
         {
-            if (this ==&rhs)
+            return equal(*this, rhs);
+        }
+
+        // Shared with compact_variant, which provides the same accessors
+        template <class V>
+        static bool equal(const V& lhs, const V& rhs)
+        {
+            if (&lhs == &rhs)
             {
                 return true;
             }
-            switch (type())
+            switch (lhs.type())
             {
                 case storage_type::null_value:
                     switch (rhs.type())
@@ -1076,6 +1225,17 @@ public:
                             return false;
                     }
                     break;
+                case storage_type::empty_array_value:
+                    switch (rhs.type())
+                    {
+                        case storage_type::empty_array_value:
+                            return true;
+                        case storage_type::array_value:
+                            return rhs.size() == 0;
+                        default:
+                            return false;
+                    }
+                    break;
                 case storage_type::empty_object_value:
                     switch (rhs.type())
                     {
@@ -1091,7 +1251,7 @@ public:
                     switch (rhs.type())
                     {
                         case storage_type::bool_value:
-                            return bool_data_cast()->value() == rhs.bool_data_cast()->value();
+                            return lhs.bool_data_cast()->value() == rhs.bool_data_cast()->value();
                         default:
                             return false;
                     }
@@ -1100,11 +1260,11 @@ public:
                     switch (rhs.type())
                     {
                         case storage_type::int64_value:
-                            return int64_data_cast()->value() == rhs.int64_data_cast()->value();
+                            return lhs.int64_data_cast()->value() == rhs.int64_data_cast()->value();
                         case storage_type::uint64_value:
-                            return int64_data_cast()->value() >= 0 ? static_cast<uint64_t>(int64_data_cast()->value()) == rhs.uint64_data_cast()->value() : false;
+                            return lhs.int64_data_cast()->value() >= 0 ? static_cast<uint64_t>(lhs.int64_data_cast()->value()) == rhs.uint64_data_cast()->value() : false;
                         case storage_type::double_value:
-                            return static_cast<double>(int64_data_cast()->value()) == rhs.double_data_cast()->value();
+                            return static_cast<double>(lhs.int64_data_cast()->value()) == rhs.double_data_cast()->value();
                         default:
                             return false;
                     }
@@ -1113,11 +1273,11 @@ public:
                     switch (rhs.type())
                     {
                         case storage_type::int64_value:
-                            return rhs.int64_data_cast()->value() >= 0 ? uint64_data_cast()->value() == static_cast<uint64_t>(rhs.int64_data_cast()->value()) : false;
+                            return rhs.int64_data_cast()->value() >= 0 ? lhs.uint64_data_cast()->value() == static_cast<uint64_t>(rhs.int64_data_cast()->value()) : false;
                         case storage_type::uint64_value:
-                            return uint64_data_cast()->value() == rhs.uint64_data_cast()->value();
+                            return lhs.uint64_data_cast()->value() == rhs.uint64_data_cast()->value();
                         case storage_type::double_value:
-                            return static_cast<double>(uint64_data_cast()->value()) == rhs.double_data_cast()->value();
+                            return static_cast<double>(lhs.uint64_data_cast()->value()) == rhs.double_data_cast()->value();
                         default:
                             return false;
                     }
@@ -1126,11 +1286,11 @@ public:
                     switch (rhs.type())
                     {
                         case storage_type::int64_value:
-                            return double_data_cast()->value() == static_cast<double>(rhs.int64_data_cast()->value());
+                            return lhs.double_data_cast()->value() == static_cast<double>(rhs.int64_data_cast()->value());
                         case storage_type::uint64_value:
-                            return double_data_cast()->value() == static_cast<double>(rhs.uint64_data_cast()->value());
+                            return lhs.double_data_cast()->value() == static_cast<double>(rhs.uint64_data_cast()->value());
                         case storage_type::double_value:
-                            return double_data_cast()->value() == rhs.double_data_cast()->value();
+                            return lhs.double_data_cast()->value() == rhs.double_data_cast()->value();
                         default:
                             return false;
                     }
@@ -1139,20 +1299,25 @@ public:
                     switch (rhs.type())
                     {
                         case storage_type::short_string_value:
-                            return as_string_view() == rhs.as_string_view();
+                            return lhs.as_string_view() == rhs.as_string_view();
                         case storage_type::long_string_value:
-                            return as_string_view() == rhs.as_string_view();
+                            return lhs.as_string_view() == rhs.as_string_view();
+                        case storage_type::borrowed_string_value:
+                            return lhs.as_string_view() == rhs.as_string_view();
                         default:
                             return false;
                     }
                     break;
                 case storage_type::long_string_value:
+                case storage_type::borrowed_string_value:
                     switch (rhs.type())
                     {
                         case storage_type::short_string_value:
-                            return as_string_view() == rhs.as_string_view();
+                            return lhs.as_string_view() == rhs.as_string_view();
                         case storage_type::long_string_value:
-                            return as_string_view() == rhs.as_string_view();
+                            return lhs.as_string_view() == rhs.as_string_view();
+                        case storage_type::borrowed_string_value:
+                            return lhs.as_string_view() == rhs.as_string_view();
                         default:
                             return false;
                     }
@@ -1162,7 +1327,7 @@ public:
                     {
                         case storage_type::byte_string_value:
                         {
-                            return as_byte_string_view() == rhs.as_byte_string_view();
+                            return lhs.as_byte_string_view() == rhs.as_byte_string_view();
                         }
                         default:
                             return false;
@@ -1171,8 +1336,10 @@ public:
                 case storage_type::array_value:
                     switch (rhs.type())
                     {
+                        case storage_type::empty_array_value:
+                            return lhs.size() == 0;
                         case storage_type::array_value:
-                            return array_data_cast()->value() == rhs.array_data_cast()->value();
+                            return lhs.array_data_cast()->value() == rhs.array_data_cast()->value();
                         default:
                             return false;
                     }
@@ -1181,9 +1348,9 @@ public:
                     switch (rhs.type())
                     {
                         case storage_type::empty_object_value:
-                            return size() == 0;
+                            return lhs.size() == 0;
                         case storage_type::object_value:
-                            return object_data_cast()->value() == rhs.object_data_cast()->value();
+                            return lhs.object_data_cast()->value() == rhs.object_data_cast()->value();
                         default:
                             return false;
                     }
@@ -1199,16 +1366,48 @@ public:
             return !(*this == rhs);
         }
 
+        // Values of different types order by type, with a borrowed string ranked as a string
+        // and an empty array as an array
+        static int type_rank(storage_type type)
+        {
+            switch (type)
+            {
+                case storage_type::borrowed_string_value:
+                    return (int)storage_type::long_string_value;
+                case storage_type::empty_array_value:
+                    return (int)storage_type::array_value;
+                default:
+                    return (int)type;
+            }
+        }
+
         bool operator<(const variant& rhs) const
         {
-            if (this == &rhs)
+            return less(*this, rhs);
+        }
+
+        template <class V>
+        static bool less(const V& lhs, const V& rhs)
+        {
+            if (&lhs == &rhs)
             {
                 return false;
             }
-            switch (type())
+            switch (lhs.type())
             {
                 case storage_type::null_value:
-                    return (int)type() < (int)rhs.type();
+                    return type_rank(lhs.type()) < type_rank(rhs.type());
+                case storage_type::empty_array_value:
+                    switch (rhs.type())
+                    {
+                        case storage_type::empty_array_value:
+                            return false;
+                        case storage_type::array_value:
+                            return rhs.size() != 0;
+                        default:
+                            return type_rank(lhs.type()) < type_rank(rhs.type());
+                    }
+                    break;
                 case storage_type::empty_object_value:
                     switch (rhs.type())
                     {
@@ -1217,77 +1416,82 @@ public:
                         case storage_type::object_value:
                             return rhs.size() != 0;
                         default:
-                            return (int)type() < (int)rhs.type();
+                            return type_rank(lhs.type()) < type_rank(rhs.type());
                     }
                     break;
                 case storage_type::bool_value:
                     switch (rhs.type())
                     {
                         case storage_type::bool_value:
-                            return bool_data_cast()->value() < rhs.bool_data_cast()->value();
+                            return lhs.bool_data_cast()->value() < rhs.bool_data_cast()->value();
                         default:
-                            return (int)type() < (int)rhs.type();
+                            return type_rank(lhs.type()) < type_rank(rhs.type());
                     }
                     break;
                 case storage_type::int64_value:
                     switch (rhs.type())
                     {
                         case storage_type::int64_value:
-                            return int64_data_cast()->value() < rhs.int64_data_cast()->value();
+                            return lhs.int64_data_cast()->value() < rhs.int64_data_cast()->value();
                         case storage_type::uint64_value:
-                            return int64_data_cast()->value() >= 0 ? static_cast<uint64_t>(int64_data_cast()->value()) < rhs.uint64_data_cast()->value() : true;
+                            return lhs.int64_data_cast()->value() >= 0 ? static_cast<uint64_t>(lhs.int64_data_cast()->value()) < rhs.uint64_data_cast()->value() : true;
                         case storage_type::double_value:
-                            return static_cast<double>(int64_data_cast()->value()) < rhs.double_data_cast()->value();
+                            return static_cast<double>(lhs.int64_data_cast()->value()) < rhs.double_data_cast()->value();
                         default:
-                            return (int)type() < (int)rhs.type();
+                            return type_rank(lhs.type()) < type_rank(rhs.type());
                     }
                     break;
                 case storage_type::uint64_value:
                     switch (rhs.type())
                     {
                         case storage_type::int64_value:
-                            return rhs.int64_data_cast()->value() >= 0 ? uint64_data_cast()->value() < static_cast<uint64_t>(rhs.int64_data_cast()->value()) : true;
+                            return rhs.int64_data_cast()->value() >= 0 ? lhs.uint64_data_cast()->value() < static_cast<uint64_t>(rhs.int64_data_cast()->value()) : true;
                         case storage_type::uint64_value:
-                            return uint64_data_cast()->value() < rhs.uint64_data_cast()->value();
+                            return lhs.uint64_data_cast()->value() < rhs.uint64_data_cast()->value();
                         case storage_type::double_value:
-                            return static_cast<double>(uint64_data_cast()->value()) < rhs.double_data_cast()->value();
+                            return static_cast<double>(lhs.uint64_data_cast()->value()) < rhs.double_data_cast()->value();
                         default:
-                            return (int)type() < (int)rhs.type();
+                            return type_rank(lhs.type()) < type_rank(rhs.type());
                     }
                     break;
                 case storage_type::double_value:
                     switch (rhs.type())
                     {
                         case storage_type::int64_value:
-                            return double_data_cast()->value() < static_cast<double>(rhs.int64_data_cast()->value());
+                            return lhs.double_data_cast()->value() < static_cast<double>(rhs.int64_data_cast()->value());
                         case storage_type::uint64_value:
-                            return double_data_cast()->value() < static_cast<double>(rhs.uint64_data_cast()->value());
+                            return lhs.double_data_cast()->value() < static_cast<double>(rhs.uint64_data_cast()->value());
                         case storage_type::double_value:
-                            return double_data_cast()->value() < rhs.double_data_cast()->value();
+                            return lhs.double_data_cast()->value() < rhs.double_data_cast()->value();
                         default:
-                            return (int)type() < (int)rhs.type();
+                            return type_rank(lhs.type()) < type_rank(rhs.type());
                     }
                     break;
                 case storage_type::short_string_value:
                     switch (rhs.type())
                     {
                         case storage_type::short_string_value:
-                            return as_string_view() < rhs.as_string_view();
+                            return lhs.as_string_view() < rhs.as_string_view();
                         case storage_type::long_string_value:
-                            return as_string_view() < rhs.as_string_view();
+                            return lhs.as_string_view() < rhs.as_string_view();
+                        case storage_type::borrowed_string_value:
+                            return lhs.as_string_view() < rhs.as_string_view();
                         default:
-                            return (int)type() < (int)rhs.type();
+                            return type_rank(lhs.type()) < type_rank(rhs.type());
                     }
                     break;
                 case storage_type::long_string_value:
+                case storage_type::borrowed_string_value:
                     switch (rhs.type())
                     {
                         case storage_type::short_string_value:
-                            return as_string_view() < rhs.as_string_view();
+                            return lhs.as_string_view() < rhs.as_string_view();
                         case storage_type::long_string_value:
-                            return as_string_view() < rhs.as_string_view();
+                            return lhs.as_string_view() < rhs.as_string_view();
+                        case storage_type::borrowed_string_value:
+                            return lhs.as_string_view() < rhs.as_string_view();
                         default:
-                            return (int)type() < (int)rhs.type();
+                            return type_rank(lhs.type()) < type_rank(rhs.type());
                     }
                     break;
                 case storage_type::byte_string_value:
@@ -1295,19 +1499,21 @@ public:
                     {
                         case storage_type::byte_string_value:
                         {
-                            return as_byte_string_view() < rhs.as_byte_string_view();
+                            return lhs.as_byte_string_view() < rhs.as_byte_string_view();
                         }
                         default:
-                            return (int)type() < (int)rhs.type();
+                            return type_rank(lhs.type()) < type_rank(rhs.type());
                     }
                     break;
                 case storage_type::array_value:
                     switch (rhs.type())
                     {
+                        case storage_type::empty_array_value:
+                            return false;
                         case storage_type::array_value:
-                            return array_data_cast()->value() < rhs.array_data_cast()->value();
+                            return lhs.array_data_cast()->value() < rhs.array_data_cast()->value();
                         default:
-                            return (int)type() < (int)rhs.type();
+                            return type_rank(lhs.type()) < type_rank(rhs.type());
                     }
                     break;
                 case storage_type::object_value:
@@ -1316,9 +1522,9 @@ public:
                         case storage_type::empty_object_value:
                             return false;
                         case storage_type::object_value:
-                            return object_data_cast()->value() < rhs.object_data_cast()->value();
+                            return lhs.object_data_cast()->value() < rhs.object_data_cast()->value();
                         default:
-                            return (int)type() < (int)rhs.type();
+                            return type_rank(lhs.type()) < type_rank(rhs.type());
                     }
                     break;
                 default:
@@ -1354,6 +1560,9 @@ public:
                 case storage_type::null_value:
                     new(reinterpret_cast<void*>(&(other.data_)))null_data(*null_data_cast());
                     break;
+                case storage_type::empty_array_value:
+                    new(reinterpret_cast<void*>(&(other.data_)))empty_array_data(*empty_array_data_cast());
+                    break;
                 case storage_type::empty_object_value:
                     new(reinterpret_cast<void*>(&(other.data_)))empty_object_data(*empty_object_data_cast());
                     break;
@@ -1375,6 +1584,9 @@ public:
                 case storage_type::long_string_value:
                     new(reinterpret_cast<void*>(&other.data_))long_string_data(std::move(*string_data_cast()));
                     break;
+                case storage_type::borrowed_string_value:
+                    new(reinterpret_cast<void*>(&(other.data_)))borrowed_string_data(*borrowed_string_data_cast());
+                    break;
                 case storage_type::byte_string_value:
                     new(reinterpret_cast<void*>(&other.data_))byte_string_data(std::move(*byte_string_data_cast()));
                     break;
@@ -1416,6 +1628,9 @@ public:
             case storage_type::null_value:
                 new(reinterpret_cast<void*>(&data_))null_data(*(val.null_data_cast()));
                 break;
+            case storage_type::empty_array_value:
+                new(reinterpret_cast<void*>(&data_))empty_array_data(*(val.empty_array_data_cast()));
+                break;
             case storage_type::empty_object_value:
                 new(reinterpret_cast<void*>(&data_))empty_object_data(*(val.empty_object_data_cast()));
                 break;
@@ -1437,6 +1652,9 @@ public:
             case storage_type::long_string_value:
                 new(reinterpret_cast<void*>(&data_))long_string_data(*(val.string_data_cast()));
                 break;
+            case storage_type::borrowed_string_value:
+                new(reinterpret_cast<void*>(&data_))borrowed_string_data(*(val.borrowed_string_data_cast()));
+                break;
             case storage_type::byte_string_value:
                 new(reinterpret_cast<void*>(&data_))byte_string_data(*(val.byte_string_data_cast()));
                 break;
@@ -1451,151 +1669,873 @@ public:
             }
         }
 
-        void Init_(const variant& val, const Allocator& a)
+        void Init_(const variant& val, const Allocator& a)
+        {
+            switch (val.type())
+            {
+            case storage_type::null_value:
+            case storage_type::empty_array_value:
+            case storage_type::empty_object_value:
+            case storage_type::bool_value:
+            case storage_type::int64_value:
+            case storage_type::uint64_value:
+            case storage_type::double_value:
+            case storage_type::short_string_value:
+            case storage_type::borrowed_string_value:
+                Init_(val);
+                break;
+            case storage_type::long_string_value:
+                new(reinterpret_cast<void*>(&data_))long_string_data(*(val.string_data_cast()),a);
+                break;
+            case storage_type::byte_string_value:
+                new(reinterpret_cast<void*>(&data_))byte_string_data(*(val.byte_string_data_cast()),a);
+                break;
+            case storage_type::array_value:
+                new(reinterpret_cast<void*>(&data_))array_data(*(val.array_data_cast()),a);
+                break;
+            case storage_type::object_value:
+                new(reinterpret_cast<void*>(&data_))object_data(*(val.object_data_cast()),a);
+                break;
+            default:
+                break;
+            }
+        }
+
+        void Init_rv_(variant&& val) noexcept
+        {
+            switch (val.type())
+            {
+            case storage_type::null_value:
+            case storage_type::empty_array_value:
+            case storage_type::empty_object_value:
+            case storage_type::double_value:
+            case storage_type::int64_value:
+            case storage_type::uint64_value:
+            case storage_type::bool_value:
+            case storage_type::short_string_value:
+            case storage_type::borrowed_string_value:
+                Init_(val);
+                break;
+            case storage_type::long_string_value:
+                {
+                    new(reinterpret_cast<void*>(&data_))long_string_data(std::move(*val.string_data_cast()));
+                    new(reinterpret_cast<void*>(&val.data_))null_data();
+                }
+                break;
+            case storage_type::byte_string_value:
+                {
+                    new(reinterpret_cast<void*>(&data_))byte_string_data(std::move(*val.byte_string_data_cast()));
+                    new(reinterpret_cast<void*>(&val.data_))null_data();
+                }
+                break;
+            case storage_type::array_value:
+                {
+                    new(reinterpret_cast<void*>(&data_))array_data(std::move(*val.array_data_cast()));
+                    new(reinterpret_cast<void*>(&val.data_))null_data();
+                }
+                break;
+            case storage_type::object_value:
+                {
+                    new(reinterpret_cast<void*>(&data_))object_data(std::move(*val.object_data_cast()));
+                    new(reinterpret_cast<void*>(&val.data_))null_data();
+                }
+                break;
+            default:
+                JSONCONS_UNREACHABLE();
+                break;
+            }
+        }
+
+        void Init_rv_(variant&& val, const Allocator&, std::true_type) noexcept
+        {
+            Init_rv_(std::forward<variant>(val));
+        }
+
+        void Init_rv_(variant&& val, const Allocator& a, std::false_type) noexcept
+        {
+            switch (val.type())
+            {
+            case storage_type::null_value:
+            case storage_type::empty_array_value:
+            case storage_type::empty_object_value:
+            case storage_type::double_value:
+            case storage_type::int64_value:
+            case storage_type::uint64_value:
+            case storage_type::bool_value:
+            case storage_type::short_string_value:
+            case storage_type::borrowed_string_value:
+                Init_(std::forward<variant>(val));
+                break;
+            case storage_type::long_string_value:
+                {
+                    if (a == val.string_data_cast()->get_allocator())
+                    {
+                        Init_rv_(std::forward<variant>(val), a, std::true_type());
+                    }
+                    else
+                    {
+                        Init_(val,a);
+                    }
+                }
+                break;
+            case storage_type::byte_string_value:
+                {
+                    if (a == val.byte_string_data_cast()->get_allocator())
+                    {
+                        Init_rv_(std::forward<variant>(val), a, std::true_type());
+                    }
+                    else
+                    {
+                        Init_(val,a);
+                    }
+                }
+                break;
+            case storage_type::object_value:
+                {
+                    if (a == val.object_data_cast()->get_allocator())
+                    {
+                        Init_rv_(std::forward<variant>(val), a, std::true_type());
+                    }
+                    else
+                    {
+                        Init_(val,a);
+                    }
+                }
+                break;
+            case storage_type::array_value:
+                {
+                    if (a == val.array_data_cast()->get_allocator())
+                    {
+                        Init_rv_(std::forward<variant>(val), a, std::true_type());
+                    }
+                    else
+                    {
+                        Init_(val,a);
+                    }
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    };
+
+    // compact_variant
+
+    // The 8 byte value of compact_policy. A double is stored as itself, with a NaN stored as the
+    // canonical quiet NaN. Any other value is NaN-boxed: the top 13 bits are all ones, the next
+    // 3 bits give its kind, and the low 48 bits its payload. Null, bool, empty containers, integers
+    // that fit in 48 bits and very short strings are stored inline if their tag is none. Other
+    // strings, byte strings, arrays and objects without a tag are stored as a pointer to their heap
+    // data, with the kind of data in the low 3 bits of the pointer. Remaining values, including
+    // every value with a tag, are held in a variant on the heap, so the tag only takes space when
+    // it is not none.
+    class compact_variant
+    {
+        static_assert(is_stateless<Allocator>::value, "compact_policy requires a stateless allocator");
+        static_assert(std::is_pointer<typename std::allocator_traits<Allocator>::pointer>::value, "compact_policy requires an allocator with plain pointers");
+        static_assert(sizeof(double) == sizeof(uint64_t), "compact_policy requires a 64 bit double");
+
+        enum class kind : uint8_t {special = 1, int48, uint48, short_string, boxed, pointer};
+
+        enum class pointer_kind : uint8_t {long_string, byte_string, array, object};
+
+        static constexpr uint64_t box_mask = 0xfff8000000000000ULL;
+        static constexpr uint64_t payload_mask = 0x0000ffffffffffffULL;
+        static constexpr uint64_t pointer_kind_mask = 0x7;
+        static constexpr uint64_t int48_sign = 0x0000800000000000ULL;
+        static constexpr uint64_t canonical_nan = 0x7ff8000000000000ULL;
+        static constexpr uint64_t true_flag = 0x100;
+
+        // Characters of a short string occupy the low 40 bits of the payload, its length the high 8.
+        // On a big endian machine wider characters start at byte 4, so that they are aligned.
+        static constexpr size_t chars_offset = jsoncons::detail::endian::native == jsoncons::detail::endian::little 
+            ? 0 : (sizeof(char_type) == 1 ? 3 : 4);
+
+        typedef typename variant::null_data null_data;
+        typedef typename variant::empty_object_data empty_object_data;
+        typedef typename variant::empty_array_data empty_array_data;
+        typedef typename variant::bool_data bool_data;
+        typedef typename variant::int64_data int64_data;
+        typedef typename variant::uint64_data uint64_data;
+        typedef typename variant::double_data double_data;
+        typedef typename variant::borrowed_string_data borrowed_string_data;
+
+        typedef jsoncons::detail::heap_only_string_factory<char_type,Allocator> string_factory_type;
+        typedef typename string_factory_type::string_pointer string_pointer;
+
+        typedef typename std::allocator_traits<Allocator>:: template rebind_alloc<variant> box_allocator_type;
+
+        template <class Data>
+        class data_holder
+        {
+            Data data_;
+        public:
+            template <class... Args>
+            data_holder(Args&&... args)
+                : data_(std::forward<Args>(args)...)
+            {
+            }
+
+            const Data* operator->() const
+            {
+                return &data_;
+            }
+        };
+
+        class short_string_ref
+        {
+            const char_type* data_;
+            uint8_t length_;
+        public:
+            short_string_ref(const char_type* data, uint8_t length)
+                : data_(data), length_(length)
+            {
+            }
+
+            const short_string_ref* operator->() const
+            {
+                return this;
+            }
+
+            uint8_t length() const
+            {
+                return length_;
+            }
+
+            const char_type* data() const
+            {
+                return data_;
+            }
+
+            const char_type* c_str() const
+            {
+                return data_;
+            }
+        };
+
+        class string_ref
+        {
+            const char_type* data_;
+            size_t length_;
+        public:
+            string_ref(const char_type* data, size_t length)
+                : data_(data), length_(length)
+            {
+            }
+
+            const string_ref* operator->() const
+            {
+                return this;
+            }
+
+            size_t length() const
+            {
+                return length_;
+            }
+
+            const char_type* data() const
+            {
+                return data_;
+            }
+
+            const char_type* c_str() const
+            {
+                return data_;
+            }
+
+            allocator_type get_allocator() const
+            {
+                return allocator_type();
+            }
+        };
+
+        class byte_string_ref
+        {
+            const uint8_t* data_;
+            size_t length_;
+        public:
+            byte_string_ref(const uint8_t* data, size_t length)
+                : data_(data), length_(length)
+            {
+            }
+
+            const byte_string_ref* operator->() const
+            {
+                return this;
+            }
+
+            const uint8_t* data() const
+            {
+                return data_;
+            }
+
+            size_t length() const
+            {
+                return length_;
+            }
+
+            const uint8_t* begin() const
+            {
+                return data_;
+            }
+
+            const uint8_t* end() const
+            {
+                return data_ + length_;
+            }
+
+            allocator_type get_allocator() const
+            {
+                return allocator_type();
+            }
+        };
+
+        template <class T>
+        class container_ref
+        {
+            T* ptr_;
+        public:
+            explicit container_ref(T* ptr)
+                : ptr_(ptr)
+            {
+            }
+
+            const container_ref* operator->() const
+            {
+                return this;
+            }
+
+            T& value() const
+            {
+                return *ptr_;
+            }
+
+            allocator_type get_allocator() const
+            {
+                return allocator_type();
+            }
+        };
+
+        typename std::aligned_storage<sizeof(uint64_t),alignof(uint64_t)>::type data_;
+    public:
+        static const size_t max_short_string_length = 5/sizeof(char_type) - 1;
+
+        template <class T, class... Args,
+                  class Enable=typename std::enable_if<!std::is_same<typename std::decay<T>::type,compact_variant>::value>::type>
+        explicit compact_variant(T&& arg, Args&&... args)
+        {
+            init(variant(std::forward<T>(arg), std::forward<Args>(args)...));
+        }
+
+        compact_variant(const compact_variant& val)
+        {
+            if (val.is_boxed())
+            {
+                init_box(variant(*val.box()));
+            }
+            else if (val.is_pointer())
+            {
+                init_copy(val);
+            }
+            else
+            {
+                bits(val.bits());
+            }
+        }
+
+        compact_variant(const compact_variant& val, const Allocator&)
+            : compact_variant(val)
+        {
+        }
+
+        compact_variant(compact_variant&& val) noexcept
+        {
+            bits(val.bits());
+            val.set(kind::special, static_cast<uint64_t>(storage_type::null_value));
+        }
+
+        compact_variant(compact_variant&& val, const Allocator&) noexcept
+            : compact_variant(std::move(val))
+        {
+        }
+
+        ~compact_variant()
+        {
+            destroy();
+        }
+
+        compact_variant& operator=(const compact_variant& val)
+        {
+            if (this != &val)
+            {
+                compact_variant temp(val);
+                swap(temp);
+            }
+            return *this;
+        }
+
+        compact_variant& operator=(compact_variant&& val) noexcept
+        {
+            if (this != &val)
+            {
+                swap(val);
+            }
+            return *this;
+        }
+
+        void swap(compact_variant& other) noexcept
+        {
+            std::swap(data_, other.data_);
+        }
+
+        storage_type type() const
+        {
+            const uint64_t b = bits();
+            if ((b & box_mask) != box_mask)
+            {
+                return storage_type::double_value;
+            }
+            switch (kind_of(b))
+            {
+                case kind::special:
+                    return static_cast<storage_type>(b & 0xff);
+                case kind::int48:
+                    return storage_type::int64_value;
+                case kind::uint48:
+                    return storage_type::uint64_value;
+                case kind::short_string:
+                    return storage_type::short_string_value;
+                case kind::pointer:
+                    switch (pointer_kind_of(b))
+                    {
+                        case pointer_kind::long_string:
+                            return storage_type::long_string_value;
+                        case pointer_kind::byte_string:
+                            return storage_type::byte_string_value;
+                        case pointer_kind::array:
+                            return storage_type::array_value;
+                        default:
+                            return storage_type::object_value;
+                    }
+                default:
+                    return box()->type();
+            }
+        }
+
+        semantic_tag tag() const
+        {
+            return is_boxed() ? box()->tag() : semantic_tag::none;
+        }
+
+        data_holder<null_data> null_data_cast() const
+        {
+            return is_boxed() ? data_holder<null_data>(*box()->null_data_cast()) : data_holder<null_data>(semantic_tag::none);
+        }
+
+        data_holder<empty_object_data> empty_object_data_cast() const
+        {
+            return data_holder<empty_object_data>(tag());
+        }
+
+        data_holder<empty_array_data> empty_array_data_cast() const
+        {
+            return data_holder<empty_array_data>(tag());
+        }
+
+        data_holder<bool_data> bool_data_cast() const
+        {
+            return is_boxed() ? data_holder<bool_data>(*box()->bool_data_cast())
+                              : data_holder<bool_data>((bits() & true_flag) != 0, semantic_tag::none);
+        }
+
+        data_holder<int64_data> int64_data_cast() const
+        {
+            return is_boxed() ? data_holder<int64_data>(*box()->int64_data_cast())
+                              : data_holder<int64_data>(static_cast<int64_t>((bits() & payload_mask) ^ int48_sign) - static_cast<int64_t>(int48_sign));
+        }
+
+        data_holder<uint64_data> uint64_data_cast() const
+        {
+            return is_boxed() ? data_holder<uint64_data>(*box()->uint64_data_cast())
+                              : data_holder<uint64_data>(bits() & payload_mask);
+        }
+
+        data_holder<double_data> double_data_cast() const
+        {
+            if (is_boxed())
+            {
+                return data_holder<double_data>(*box()->double_data_cast());
+            }
+            double val;
+            uint64_t b = bits();
+            std::memcpy(&val, &b, sizeof(double));
+            return data_holder<double_data>(val);
+        }
+
+        short_string_ref short_string_data_cast() const
+        {
+            if (is_boxed())
+            {
+                return short_string_ref(box()->short_string_data_cast()->data(), box()->short_string_data_cast()->length());
+            }
+            return short_string_ref(reinterpret_cast<const char_type*>(reinterpret_cast<const uint8_t*>(&data_) + chars_offset),
+                                    static_cast<uint8_t>((bits() >> 40) & 0xff));
+        }
+
+        const borrowed_string_data* borrowed_string_data_cast() const
+        {
+            return box()->borrowed_string_data_cast();
+        }
+
+        string_ref string_data_cast() const
+        {
+            if (is_pointer())
+            {
+                const string_pointer p = static_cast<string_pointer>(address());
+                return string_ref(p->data(), p->length());
+            }
+            return string_ref(box()->string_data_cast()->data(), box()->string_data_cast()->length());
+        }
+
+        byte_string_ref byte_string_data_cast() const
+        {
+            if (is_pointer())
+            {
+                const byte_string_storage_type* p = static_cast<const byte_string_storage_type*>(address());
+                return byte_string_ref(p->data(), p->size());
+            }
+            return byte_string_ref(box()->byte_string_data_cast()->data(), box()->byte_string_data_cast()->length());
+        }
+
+        container_ref<object> object_data_cast()
+        {
+            return container_ref<object>(is_pointer() ? static_cast<object*>(address()) : &box()->object_data_cast()->value());
+        }
+
+        container_ref<const object> object_data_cast() const
+        {
+            return container_ref<const object>(is_pointer() ? static_cast<const object*>(address()) : &box()->object_data_cast()->value());
+        }
+
+        container_ref<array> array_data_cast()
+        {
+            return container_ref<array>(is_pointer() ? static_cast<array*>(address()) : &box()->array_data_cast()->value());
+        }
+
+        container_ref<const array> array_data_cast() const
+        {
+            return container_ref<const array>(is_pointer() ? static_cast<const array*>(address()) : &box()->array_data_cast()->value());
+        }
+
+        size_t size() const
+        {
+            switch (type())
+            {
+                case storage_type::array_value:
+                    return array_data_cast()->value().size();
+                case storage_type::object_value:
+                    return object_data_cast()->value().size();
+                default:
+                    return 0;
+            }
+        }
+
+        string_view_type as_string_view() const
+        {
+            if (is_boxed())
+            {
+                return box()->as_string_view();
+            }
+            switch (type())
+            {
+                case storage_type::short_string_value:
+                {
+                    auto s = short_string_data_cast();
+                    return string_view_type(s.data(), s.length());
+                }
+                case storage_type::long_string_value:
+                {
+                    auto s = string_data_cast();
+                    return string_view_type(s.data(), s.length());
+                }
+                default:
+                    JSONCONS_THROW(json_runtime_error<std::runtime_error>("Not a string"));
+            }
+        }
+
+        template <typename BAllocator=std::allocator<uint8_t>>
+        basic_byte_string<BAllocator> as_byte_string() const
+        {
+            return variant::template to_byte_string<BAllocator>(*this);
+        }
+
+        byte_string_view as_byte_string_view() const
+        {
+            if (type() != storage_type::byte_string_value)
+            {
+                JSONCONS_THROW(json_runtime_error<std::runtime_error>("Not a byte string"));
+            }
+            auto b = byte_string_data_cast();
+            return byte_string_view(b.data(), b.length());
+        }
+
+        template <class UserAllocator=std::allocator<uint8_t>>
+        basic_bignum<UserAllocator> as_bignum() const
+        {
+            return variant::template to_bignum<UserAllocator>(*this);
+        }
+
+        bool operator==(const compact_variant& rhs) const
+        {
+            if (!is_boxed() && !rhs.is_boxed() && bits() == rhs.bits() && type() != storage_type::double_value)
+            {
+                return true;
+            }
+            return variant::equal(*this, rhs);
+        }
+
+        bool operator!=(const compact_variant& rhs) const
+        {
+            return !(*this == rhs);
+        }
+
+        bool operator<(const compact_variant& rhs) const
+        {
+            return variant::less(*this, rhs);
+        }
+
+    private:
+        uint64_t bits() const
+        {
+            uint64_t b;
+            std::memcpy(&b, &data_, sizeof(uint64_t));
+            return b;
+        }
+
+        void bits(uint64_t b)
         {
-            switch (val.type())
-            {
-            case storage_type::null_value:
-            case storage_type::empty_object_value:
-            case storage_type::bool_value:
-            case storage_type::int64_value:
-            case storage_type::uint64_value:
-            case storage_type::double_value:
-            case storage_type::short_string_value:
-                Init_(val);
-                break;
-            case storage_type::long_string_value:
-                new(reinterpret_cast<void*>(&data_))long_string_data(*(val.string_data_cast()),a);
-                break;
-            case storage_type::byte_string_value:
-                new(reinterpret_cast<void*>(&data_))byte_string_data(*(val.byte_string_data_cast()),a);
-                break;
-            case storage_type::array_value:
-                new(reinterpret_cast<void*>(&data_))array_data(*(val.array_data_cast()),a);
-                break;
-            case storage_type::object_value:
-                new(reinterpret_cast<void*>(&data_))object_data(*(val.object_data_cast()),a);
-                break;
-            default:
-                break;
-            }
+            std::memcpy(&data_, &b, sizeof(uint64_t));
         }
 
-        void Init_rv_(variant&& val) noexcept
+        void set(kind k, uint64_t payload)
         {
-            switch (val.type())
+            bits(box_mask | (static_cast<uint64_t>(k) << 48) | payload);
+        }
+
+        static kind kind_of(uint64_t b)
+        {
+            return static_cast<kind>((b >> 48) & 0x7);
+        }
+
+        static pointer_kind pointer_kind_of(uint64_t b)
+        {
+            return static_cast<pointer_kind>(b & pointer_kind_mask);
+        }
+
+        bool is_boxed() const
+        {
+            const uint64_t b = bits();
+            return (b & box_mask) == box_mask && kind_of(b) == kind::boxed;
+        }
+
+        bool is_pointer() const
+        {
+            const uint64_t b = bits();
+            return (b & box_mask) == box_mask && kind_of(b) == kind::pointer;
+        }
+
+        variant* box() const
+        {
+            return reinterpret_cast<variant*>(static_cast<uintptr_t>(bits() & payload_mask));
+        }
+
+        void* address() const
+        {
+            return reinterpret_cast<void*>(static_cast<uintptr_t>(bits() & payload_mask & ~pointer_kind_mask));
+        }
+
+        void set_pointer(pointer_kind k, const void* p)
+        {
+            const uint64_t address = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(p));
+            JSONCONS_ASSERT((address & ~payload_mask) == 0 && (address & pointer_kind_mask) == 0);
+            set(kind::pointer, address | static_cast<uint64_t>(k));
+        }
+
+        template <class T, class... Args>
+        static T* create(Args&&... args)
+        {
+            typedef typename std::allocator_traits<Allocator>:: template rebind_alloc<T> data_allocator_type;
+            data_allocator_type alloc;
+            T* p = jsoncons::detail::to_plain_pointer(alloc.allocate(1));
+            JSONCONS_TRY
             {
-            case storage_type::null_value:
-            case storage_type::empty_object_value:
-            case storage_type::double_value:
-            case storage_type::int64_value:
-            case storage_type::uint64_value:
-            case storage_type::bool_value:
-            case storage_type::short_string_value:
-                Init_(val);
-                break;
-            case storage_type::long_string_value:
-                {
-                    new(reinterpret_cast<void*>(&data_))long_string_data(std::move(*val.string_data_cast()));
-                    new(reinterpret_cast<void*>(&val.data_))null_data();
-                }
-                break;
-            case storage_type::byte_string_value:
-                {
-                    new(reinterpret_cast<void*>(&data_))byte_string_data(std::move(*val.byte_string_data_cast()));
-                    new(reinterpret_cast<void*>(&val.data_))null_data();
-                }
-                break;
-            case storage_type::array_value:
-                {
-                    new(reinterpret_cast<void*>(&data_))array_data(std::move(*val.array_data_cast()));
-                    new(reinterpret_cast<void*>(&val.data_))null_data();
-                }
-                break;
-            case storage_type::object_value:
-                {
-                    new(reinterpret_cast<void*>(&data_))object_data(std::move(*val.object_data_cast()));
-                    new(reinterpret_cast<void*>(&val.data_))null_data();
-                }
-                break;
-            default:
-                JSONCONS_UNREACHABLE();
-                break;
+                std::allocator_traits<data_allocator_type>::construct(alloc, p, std::forward<Args>(args)...);
+            }
+            JSONCONS_CATCH(...)
+            {
+                alloc.deallocate(p, 1);
+                JSONCONS_RETHROW;
             }
+            return p;
         }
 
-        void Init_rv_(variant&& val, const Allocator&, std::true_type) noexcept
+        template <class T>
+        static void destroy_data(T* p) noexcept
         {
-            Init_rv_(std::forward<variant>(val));
+            typedef typename std::allocator_traits<Allocator>:: template rebind_alloc<T> data_allocator_type;
+            data_allocator_type alloc;
+            std::allocator_traits<data_allocator_type>::destroy(alloc, p);
+            alloc.deallocate(p, 1);
         }
 
-        void Init_rv_(variant&& val, const Allocator& a, std::false_type) noexcept
+        void destroy() noexcept
         {
-            switch (val.type())
+            if (is_boxed())
             {
-            case storage_type::null_value:
-            case storage_type::empty_object_value:
-            case storage_type::double_value:
-            case storage_type::int64_value:
-            case storage_type::uint64_value:
-            case storage_type::bool_value:
-            case storage_type::short_string_value:
-                Init_(std::forward<variant>(val));
-                break;
-            case storage_type::long_string_value:
+                destroy_data(box());
+            }
+            else if (is_pointer())
+            {
+                switch (pointer_kind_of(bits()))
                 {
-                    if (a == val.string_data_cast()->get_allocator())
-                    {
-                        Init_rv_(std::forward<variant>(val), a, std::true_type());
-                    }
-                    else
-                    {
-                        Init_(val,a);
-                    }
+                    case pointer_kind::long_string:
+                        string_factory_type::destroy(static_cast<string_pointer>(address()));
+                        break;
+                    case pointer_kind::byte_string:
+                        destroy_data(static_cast<byte_string_storage_type*>(address()));
+                        break;
+                    case pointer_kind::array:
+                        destroy_data(static_cast<array*>(address()));
+                        break;
+                    case pointer_kind::object:
+                        destroy_data(static_cast<object*>(address()));
+                        break;
                 }
-                break;
-            case storage_type::byte_string_value:
+            }
+        }
+
+        void init_copy(const compact_variant& val)
+        {
+            switch (pointer_kind_of(val.bits()))
+            {
+                case pointer_kind::long_string:
                 {
-                    if (a == val.byte_string_data_cast()->get_allocator())
-                    {
-                        Init_rv_(std::forward<variant>(val), a, std::true_type());
-                    }
-                    else
-                    {
-                        Init_(val,a);
-                    }
+                    auto s = val.string_data_cast();
+                    set_pointer(pointer_kind::long_string, jsoncons::detail::to_plain_pointer(string_factory_type::create(s.data(), s.length(), Allocator())));
+                    break;
                 }
-                break;
-            case storage_type::object_value:
+                case pointer_kind::byte_string:
+                    set_pointer(pointer_kind::byte_string, create<byte_string_storage_type>(*static_cast<const byte_string_storage_type*>(val.address())));
+                    break;
+                case pointer_kind::array:
+                    set_pointer(pointer_kind::array, create<array>(*static_cast<const array*>(val.address())));
+                    break;
+                case pointer_kind::object:
+                    set_pointer(pointer_kind::object, create<object>(*static_cast<const object*>(val.address())));
+                    break;
+            }
+        }
+
+        void init(variant&& val)
+        {
+            if (val.tag() == semantic_tag::none)
+            {
+                switch (val.type())
                 {
-                    if (a == val.object_data_cast()->get_allocator())
+                    case storage_type::null_value:
+                    case storage_type::empty_object_value:
+                    case storage_type::empty_array_value:
+                        set(kind::special, static_cast<uint64_t>(val.type()));
+                        return;
+                    case storage_type::bool_value:
+                        set(kind::special, static_cast<uint64_t>(val.type()) | (val.bool_data_cast()->value() ? true_flag : 0));
+                        return;
+                    case storage_type::int64_value:
                     {
-                        Init_rv_(std::forward<variant>(val), a, std::true_type());
+                        const int64_t n = val.int64_data_cast()->value();
+                        if (n >= -static_cast<int64_t>(int48_sign) && n < static_cast<int64_t>(int48_sign))
+                        {
+                            set(kind::int48, static_cast<uint64_t>(n) & payload_mask);
+                            return;
+                        }
+                        break;
                     }
-                    else
+                    case storage_type::uint64_value:
                     {
-                        Init_(val,a);
+                        const uint64_t n = val.uint64_data_cast()->value();
+                        if (n <= payload_mask)
+                        {
+                            set(kind::uint48, n);
+                            return;
+                        }
+                        break;
                     }
-                }
-                break;
-            case storage_type::array_value:
-                {
-                    if (a == val.array_data_cast()->get_allocator())
+                    case storage_type::double_value:
                     {
-                        Init_rv_(std::forward<variant>(val), a, std::true_type());
+                        const double d = val.double_data_cast()->value();
+                        uint64_t b;
+                        std::memcpy(&b, &d, sizeof(double));
+                        bits(d != d ? canonical_nan : b);
+                        return;
                     }
-                    else
+                    case storage_type::short_string_value:
                     {
-                        Init_(val,a);
+                        const char_type* data = val.short_string_data_cast()->data();
+                        const size_t length = val.short_string_data_cast()->length();
+                        if (length <= max_short_string_length)
+                        {
+                            set(kind::short_string, static_cast<uint64_t>(length) << 40);
+                            uint8_t* p = reinterpret_cast<uint8_t*>(&data_) + chars_offset;
+                            std::memcpy(p, data, length*sizeof(char_type));
+                            std::memset(p + length*sizeof(char_type), 0, sizeof(char_type));
+                        }
+                        else
+                        {
+                            set_pointer(pointer_kind::long_string, jsoncons::detail::to_plain_pointer(string_factory_type::create(data, length, Allocator())));
+                        }
+                        return;
                     }
+                    case storage_type::long_string_value:
+                        set_pointer(pointer_kind::long_string, jsoncons::detail::to_plain_pointer(val.string_data_cast()->release()));
+                        return;
+                    case storage_type::byte_string_value:
+                        set_pointer(pointer_kind::byte_string, jsoncons::detail::to_plain_pointer(val.byte_string_data_cast()->release()));
+                        return;
+                    case storage_type::array_value:
+                        set_pointer(pointer_kind::array, jsoncons::detail::to_plain_pointer(val.array_data_cast()->release()));
+                        return;
+                    case storage_type::object_value:
+                        set_pointer(pointer_kind::object, jsoncons::detail::to_plain_pointer(val.object_data_cast()->release()));
+                        return;
+                    default:
+                        break;
                 }
-                break;
-            default:
-                break;
             }
+            init_box(std::move(val));
+        }
+
+        void init_box(variant&& val)
+        {
+            box_allocator_type alloc;
+            variant* p = jsoncons::detail::to_plain_pointer(alloc.allocate(1));
+            JSONCONS_TRY
+            {
+                std::allocator_traits<box_allocator_type>::construct(alloc, p, std::move(val));
+            }
+            JSONCONS_CATCH(...)
+            {
+                alloc.deallocate(p, 1);
+                JSONCONS_RETHROW;
+            }
+            const uint64_t address = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(p));
+            JSONCONS_ASSERT((address & ~payload_mask) == 0);
+            set(kind::boxed, address);
         }
     };
 
+    typedef typename std::conditional<jsoncons::detail::is_compact_policy<ImplementationPolicy>::value,compact_variant,variant>::type variant_type;
+
     template <class ParentT>
     class proxy 
     {
@@ -1633,7 +2573,7 @@ public:
             auto it = val.find(key_);
             if (it == val.object_range().end())
             {
-                it = val.insert_or_assign(val.object_range().begin(),key_,object(val.object_value().get_allocator()));            
+                it = val.insert_or_assign(val.object_range().begin(),key_,basic_json(object(val.object_value().get_allocator())));            
             }
             return it->value();
         }
@@ -2725,7 +3665,7 @@ public:
 
     static basic_json make_array(const array& a, allocator_type allocator)
     {
-        return basic_json(variant(a, semantic_tag::none, allocator));
+        return basic_json(variant_type(a, semantic_tag::none, allocator));
     }
 
     static basic_json make_array(std::initializer_list<basic_json> init, const Allocator& allocator = Allocator())
@@ -2776,7 +3716,7 @@ public:
         return a_null;
     }
 
-    variant var_;
+    variant_type var_;
 
     basic_json(semantic_tag tag = semantic_tag::none) 
         : var_(tag)
@@ -2808,33 +3748,34 @@ public:
     {
     }
 
-    basic_json(const variant& val)
+    basic_json(const variant_type& val)
         : var_(val)
     {
     }
 
-    basic_json(variant&& other) noexcept
-        : var_(std::forward<variant>(other))
+    basic_json(variant_type&& other) noexcept
+        : var_(std::forward<variant_type>(other))
     {
     }
 
+    // Empty containers with a stateless allocator are stored without allocating
     basic_json(const array& val, semantic_tag tag = semantic_tag::none)
-        : var_(val, tag)
+        : var_(val.size() == 0 && is_stateless<Allocator>::value ? variant_type(empty_array_arg_t(), tag) : variant_type(val, tag))
     {
     }
 
     basic_json(array&& other, semantic_tag tag = semantic_tag::none)
-        : var_(std::forward<array>(other), tag)
+        : var_(other.size() == 0 && is_stateless<Allocator>::value ? variant_type(empty_array_arg_t(), tag) : variant_type(std::forward<array>(other), tag))
     {
     }
 
     basic_json(const object& other, semantic_tag tag = semantic_tag::none)
-        : var_(other, tag)
+        : var_(other.size() == 0 && is_stateless<Allocator>::value ? variant_type(tag) : variant_type(other, tag))
     {
     }
 
     basic_json(object&& other, semantic_tag tag = semantic_tag::none)
-        : var_(std::forward<object>(other), tag)
+        : var_(other.size() == 0 && is_stateless<Allocator>::value ? variant_type(tag) : variant_type(std::forward<object>(other), tag))
     {
     }
 
@@ -2899,6 +3840,12 @@ public:
     {
     }
 
+    // Refers to the characters of sv, which must outlive the value, see detach()
+    basic_json(borrowed_string_arg_t, const string_view_type& sv, semantic_tag tag = semantic_tag::none)
+        : var_(borrowed_string_arg, sv.data(), sv.length(), tag)
+    {
+    }
+
     basic_json(null_type val, semantic_tag tag)
         : var_(val, tag)
     {
@@ -2974,7 +3921,7 @@ public:
 
     basic_json& operator=(const char_type* s)
     {
-        var_ = variant(s, char_traits_type::length(s), semantic_tag::none);
+        var_ = variant_type(s, char_traits_type::length(s), semantic_tag::none);
         return *this;
     }
 
@@ -3012,6 +3959,7 @@ public:
     {
         switch (var_.type())
         {
+        case storage_type::empty_array_value:
         case storage_type::empty_object_value:
             return 0;
         case storage_type::object_value:
@@ -3152,7 +4100,7 @@ public:
     }
 
     template <class SAllocator=std::allocator<char_type>>
-    std::basic_string<char_type,char_traits_type,SAllocator> to_string(const char_allocator_type& allocator=SAllocator()) const noexcept
+    std::basic_string<char_type,char_traits_type,SAllocator> to_string(const SAllocator& allocator=SAllocator()) const noexcept
     {
         typedef std::basic_string<char_type,char_traits_type,SAllocator> string_type;
         string_type s(allocator);
@@ -3185,6 +4133,11 @@ public:
             {
                 return var_.string_data_cast()->get_allocator();
             }
+            case storage_type::borrowed_string_value:
+            {
+                // A borrowed string owns no memory
+                return allocator_type();
+            }
             case storage_type::byte_string_value:
             {
                 return var_.byte_string_data_cast()->get_allocator();
@@ -3250,7 +4203,8 @@ public:
 
     bool is_string() const noexcept
     {
-        return (var_.type() == storage_type::long_string_value) || (var_.type() == storage_type::short_string_value);
+        return (var_.type() == storage_type::long_string_value) || (var_.type() == storage_type::short_string_value) 
+               || (var_.type() == storage_type::borrowed_string_value);
     }
 
     bool is_string_view() const noexcept
@@ -3274,6 +4228,7 @@ public:
         {
             case storage_type::short_string_value:
             case storage_type::long_string_value:
+            case storage_type::borrowed_string_value:
                 return jsoncons::detail::is_integer(as_string_view().data(), as_string_view().length());
             case storage_type::int64_value:
             case storage_type::uint64_value:
@@ -3295,7 +4250,7 @@ public:
 
     bool is_array() const noexcept
     {
-        return var_.type() == storage_type::array_value;
+        return var_.type() == storage_type::array_value || var_.type() == storage_type::empty_array_value;
     }
 
     bool is_int64() const noexcept
@@ -3323,6 +4278,7 @@ public:
                 return true;
             case storage_type::short_string_value:
             case storage_type::long_string_value:
+            case storage_type::borrowed_string_value:
                 return var_.tag() == semantic_tag::bigint ||
                        var_.tag() == semantic_tag::bigdec ||
                        var_.tag() == semantic_tag::bigfloat;
@@ -3346,8 +4302,11 @@ public:
                 return var_.short_string_data_cast()->length() == 0;
             case storage_type::long_string_value:
                 return var_.string_data_cast()->length() == 0;
+            case storage_type::borrowed_string_value:
+                return var_.borrowed_string_data_cast()->length() == 0;
             case storage_type::array_value:
                 return array_value().size() == 0;
+            case storage_type::empty_array_value:
             case storage_type::empty_object_value:
                 return true;
             case storage_type::object_value:
@@ -3383,13 +4342,36 @@ public:
 
     void create_object_implicitly(std::true_type)
     {
-        var_ = variant(object(Allocator()), semantic_tag::none);
+        var_ = variant_type(object(Allocator()), semantic_tag::none);
+    }
+
+    template<class U=Allocator>
+    void create_array_implicitly()
+    {
+        create_array_implicitly(std::integral_constant<bool, is_stateless<U>::value>());
+    }
+
+    void create_array_implicitly(std::false_type)
+    {
+        JSONCONS_THROW(json_runtime_error<std::runtime_error>("Cannot create array implicitly - allocator is stateful."));
+    }
+
+    void create_array_implicitly(std::true_type)
+    {
+        var_ = variant_type(array(Allocator()), var_.tag());
     }
 
     void reserve(size_t n)
     {
         switch (var_.type())
         {
+        case storage_type::empty_array_value:
+            if (n > 0)
+            {
+                create_array_implicitly();
+                array_value().reserve(n);
+            }
+            break;
         case storage_type::array_value:
             array_value().reserve(n);
             break;
@@ -3413,6 +4395,13 @@ public:
     {
         switch (var_.type())
         {
+        case storage_type::empty_array_value:
+            if (n == 0)
+            {
+                break;
+            }
+            create_array_implicitly();
+            JSONCONS_FALLTHROUGH;
         case storage_type::array_value:
             array_value().resize(n);
             break;
@@ -3426,6 +4415,13 @@ public:
     {
         switch (var_.type())
         {
+        case storage_type::empty_array_value:
+            if (n == 0)
+            {
+                break;
+            }
+            create_array_implicitly();
+            JSONCONS_FALLTHROUGH;
         case storage_type::array_value:
             array_value().resize(n, val);
             break;
@@ -3446,6 +4442,7 @@ public:
         {
         case storage_type::short_string_value:
         case storage_type::long_string_value:
+        case storage_type::borrowed_string_value:
             if (var_.tag() == semantic_tag::bigint)
             {
                 return static_cast<bool>(var_.as_bignum());
@@ -3485,6 +4482,7 @@ public:
         {
         case storage_type::short_string_value:
         case storage_type::long_string_value:
+        case storage_type::borrowed_string_value:
             {
                 auto result = jsoncons::detail::to_integer<T>(as_string_view().data(), as_string_view().length());
                 if (result.ec != jsoncons::detail::to_integer_errc())
@@ -3517,6 +4515,13 @@ public:
                 // to_double() throws std::invalid_argument if conversion fails
                 return to_double(as_cstring(), as_string_view().length());
             }
+            case storage_type::borrowed_string_value:
+            {
+                // Borrowed characters are not null terminated
+                std::basic_string<char_type> s(as_string_view().data(), as_string_view().length());
+                jsoncons::detail::string_to_double to_double;
+                return to_double(s.c_str(), s.length());
+            }
             case storage_type::double_value:
                 return var_.double_data_cast()->value();
             case storage_type::int64_value:
@@ -3589,6 +4594,7 @@ public:
         {
             case storage_type::short_string_value:
             case storage_type::long_string_value:
+            case storage_type::borrowed_string_value:
             {
                 return string_type(as_string_view().data(),as_string_view().length(),allocator);
             }
@@ -3683,6 +4689,9 @@ public:
             return var_.short_string_data_cast()->c_str();
         case storage_type::long_string_value:
             return var_.string_data_cast()->c_str();
+        case storage_type::borrowed_string_value:
+            // Borrowed strings are views into the caller's buffer and are not null terminated
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Not a cstring: borrowed string, call detach() first"));
         default:
             JSONCONS_THROW(json_runtime_error<std::runtime_error>("Not a cstring"));
         }
@@ -3762,6 +4771,8 @@ public:
     {
         switch (var_.type())
         {
+        case storage_type::empty_array_value:
+            JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
         case storage_type::array_value:
             if (i >= array_value().size())
             {
@@ -3779,6 +4790,8 @@ public:
     {
         switch (var_.type())
         {
+        case storage_type::empty_array_value:
+            JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
         case storage_type::array_value:
             if (i >= array_value().size())
             {
@@ -3910,6 +4923,42 @@ public:
 
     // Modifiers
 
+    // Replaces borrowed strings with owned copies
+    // Walks the document with an explicit stack, so deep nesting cannot overflow the call stack
+    void detach()
+    {
+        std::vector<basic_json*> stack;
+        stack.push_back(this);
+        while (!stack.empty())
+        {
+            basic_json* current = stack.back();
+            stack.pop_back();
+            switch (current->var_.type())
+            {
+            case storage_type::borrowed_string_value:
+                {
+                    string_view_type sv = current->as_string_view();
+                    current->var_ = variant_type(sv.data(), sv.length(), current->var_.tag());
+                }
+                break;
+            case storage_type::array_value:
+                for (auto& item : current->array_range())
+                {
+                    stack.push_back(&item);
+                }
+                break;
+            case storage_type::object_value:
+                for (auto& member : current->object_range())
+                {
+                    stack.push_back(&member.value());
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
     void shrink_to_fit()
     {
         switch (var_.type())
@@ -3974,6 +5023,8 @@ public:
     {
         switch (var_.type())
         {
+        case storage_type::empty_array_value:
+            break;
         case storage_type::array_value:
             array_value().erase(pos);
             break;
@@ -3987,6 +5038,8 @@ public:
     {
         switch (var_.type())
         {
+        case storage_type::empty_array_value:
+            break;
         case storage_type::array_value:
             array_value().erase(first, last);
             break;
@@ -4218,6 +5271,9 @@ public:
     {
         switch (var_.type())
         {
+        case storage_type::empty_array_value:
+            create_array_implicitly();
+            return array_value().insert(array_value().begin(), std::forward<T>(val));
         case storage_type::array_value:
             return array_value().insert(pos, std::forward<T>(val));
             break;
@@ -4233,6 +5289,9 @@ public:
     {
         switch (var_.type())
         {
+        case storage_type::empty_array_value:
+            create_array_implicitly();
+            return array_value().insert(array_value().begin(), first, last);
         case storage_type::array_value:
             return array_value().insert(pos, first, last);
             break;
@@ -4280,6 +5339,9 @@ public:
     {
         switch (var_.type())
         {
+        case storage_type::empty_array_value:
+            create_array_implicitly();
+            return array_value().emplace(array_value().begin(), std::forward<Args>(args)...);
         case storage_type::array_value:
             return array_value().emplace(pos, std::forward<Args>(args)...);
             break;
@@ -4295,6 +5357,9 @@ public:
     {
         switch (var_.type())
         {
+        case storage_type::empty_array_value:
+            create_array_implicitly();
+            JSONCONS_FALLTHROUGH;
         case storage_type::array_value:
             return array_value().emplace_back(std::forward<Args>(args)...);
         default:
@@ -4329,6 +5394,9 @@ public:
     {
         switch (var_.type())
         {
+        case storage_type::empty_array_value:
+            create_array_implicitly();
+            JSONCONS_FALLTHROUGH;
         case storage_type::array_value:
             array_value().push_back(std::forward<T>(val));
             break;
@@ -4408,13 +5476,13 @@ public:
         {
             {
                 case byte_string_chars_format::base16:
-                    var_ = variant(bs, semantic_tag::base16);
+                    var_ = variant_type(bs, semantic_tag::base16);
                     break;
                 case byte_string_chars_format::base64:
-                    var_ = variant(bs, semantic_tag::base64);
+                    var_ = variant_type(bs, semantic_tag::base64);
                     break;
                 case byte_string_chars_format::base64url:
-                    var_ = variant(bs, semantic_tag::base64url);
+                    var_ = variant_type(bs, semantic_tag::base64url);
                     break;
                 default:
                     break;
@@ -4966,11 +6034,11 @@ public:
 
     range<object_iterator> object_range()
     {
-        static basic_json empty_object = object();
+        static object empty_object;
         switch (var_.type())
         {
         case storage_type::empty_object_value:
-            return range<object_iterator>(empty_object.object_range().begin(), empty_object.object_range().end());
+            return range<object_iterator>(empty_object.begin(), empty_object.end());
         case storage_type::object_value:
             return range<object_iterator>(object_value().begin(),object_value().end());
         default:
@@ -4980,11 +6048,11 @@ public:
 
     range<const_object_iterator> object_range() const
     {
-        static const basic_json empty_object = object();
+        static const object empty_object;
         switch (var_.type())
         {
         case storage_type::empty_object_value:
-            return range<const_object_iterator>(empty_object.object_range().begin(), empty_object.object_range().end());
+            return range<const_object_iterator>(empty_object.begin(), empty_object.end());
         case storage_type::object_value:
             return range<const_object_iterator>(object_value().begin(),object_value().end());
         default:
@@ -4996,6 +6064,8 @@ public:
     {
         switch (var_.type())
         {
+        case storage_type::empty_array_value:
+            return range<array_iterator>(array_iterator(), array_iterator());
         case storage_type::array_value:
             return range<array_iterator>(array_value().begin(),array_value().end());
         default:
@@ -5007,6 +6077,8 @@ public:
     {
         switch (var_.type())
         {
+        case storage_type::empty_array_value:
+            return range<const_array_iterator>(const_array_iterator(), const_array_iterator());
         case storage_type::array_value:
             return range<const_array_iterator>(array_value().begin(),array_value().end());
         default:
@@ -5018,6 +6090,9 @@ public:
     {
         switch (var_.type())
         {
+        case storage_type::empty_array_value:
+            create_array_implicitly();
+            JSONCONS_FALLTHROUGH;
         case storage_type::array_value:
             return var_.array_data_cast()->value();
         default:
@@ -5030,6 +6105,9 @@ public:
     {
         switch (var_.type())
         {
+        case storage_type::empty_array_value:
+            const_cast<basic_json*>(this)->create_array_implicitly();
+            JSONCONS_FALLTHROUGH;
         case storage_type::array_value:
             return var_.array_data_cast()->value();
         default:
@@ -5076,6 +6154,7 @@ private:
         {
             case storage_type::short_string_value:
             case storage_type::long_string_value:
+            case storage_type::borrowed_string_value:
                 handler.string_value(as_string_view(), var_.tag());
                 break;
             case storage_type::byte_string_value:
@@ -5102,6 +6181,10 @@ private:
                 handler.begin_object(0, var_.tag());
                 handler.end_object();
                 break;
+            case storage_type::empty_array_value:
+                handler.begin_array(0, var_.tag());
+                handler.end_array();
+                break;
             case storage_type::object_value:
                 {
                     handler.begin_object(size(), var_.tag());
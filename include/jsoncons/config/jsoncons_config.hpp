@@ -48,6 +48,16 @@
 #define JSONCONS_UNREACHABLE() do {} while (0)
 #endif
 
+// Define JSONCONS_NO_SIMD to suppress the use of SSE2/AVX2 intrinsics
+#if !defined(JSONCONS_NO_SIMD)
+#  if defined(__AVX2__)
+#    define JSONCONS_HAS_AVX2 1
+#  endif
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define JSONCONS_HAS_SSE2 1
+#  endif
+#endif
+
 // Follows boost 1_68
 #if !defined(JSONCONS_HAS_STRING_VIEW)
 #  if defined(__clang__)
@@ -71,6 +81,16 @@
 #  endif // defined(_MSC_VER)
 #endif // !defined(JSONCONS_HAS_STRING_VIEW)
 
+#if !defined(JSONCONS_HAS_POLYMORPHIC_ALLOCATOR)
+#  if defined(__has_include)
+#   if (__cplusplus >= 201703) || (defined(_HAS_CXX17) && _HAS_CXX17 == 1)
+#    if __has_include(<memory_resource>)
+#     define JSONCONS_HAS_POLYMORPHIC_ALLOCATOR 1
+#    endif // __has_include(<memory_resource>)
+#   endif // (__cplusplus >= 201703)
+#  endif // defined(__has_include)
+#endif // !defined(JSONCONS_HAS_POLYMORPHIC_ALLOCATOR)
+
 // Deprecated symbols markup
 #if (defined(__cplusplus) && __cplusplus >= 201402L)
 #define JSONCONS_DEPRECATED_MSG(msg) [[deprecated(msg)]]
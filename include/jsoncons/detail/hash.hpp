@@ -0,0 +1,34 @@
+// Copyright 2019 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_HASH_HPP
+#define JSONCONS_DETAIL_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits> // std::make_unsigned
+
+namespace jsoncons { namespace detail {
+
+// FNV-1a hash of a character sequence. Characters are taken as unsigned, so that
+// a negative char does not sign extend and for char the hash is over the bytes.
+template <class CharT>
+size_t fnv1a_hash(const CharT* s, size_t length) noexcept
+{
+    typedef typename std::make_unsigned<CharT>::type unsigned_type;
+
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; ++i)
+    {
+        hash ^= static_cast<uint64_t>(static_cast<unsigned_type>(s[i]));
+        hash *= 1099511628211ULL;
+    }
+    return static_cast<size_t>(hash);
+}
+
+}}
+
+#endif
@@ -0,0 +1,240 @@
+// Copyright 2019 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_JSON_VIEW_BASE_HPP
+#define JSONCONS_DETAIL_JSON_VIEW_BASE_HPP
+
+#include <cstddef>
+#include <iterator> // std::input_iterator_tag
+#include <string>
+#include <type_traits> // std::enable_if
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/json_exception.hpp>
+
+namespace jsoncons { namespace detail {
+
+// json_view_base
+
+// The part of the read-only value API shared by basic_json_tape_value, basic_json_image_value
+// and basic_lazy_json. Elements and members are identified by a position within their container,
+// and Derived provides
+//
+//     void element_positions(size_t& first, size_t& last) const
+//     void member_positions(size_t& first, size_t& last) const
+//     Derived element_at(size_t position) const
+//     size_t next_element(size_t position) const
+//     Member member_at(size_t position) const
+//     size_t next_member(size_t position) const
+//     bool find_member(const string_view_type& name, size_t& position) const
+//
+// along with is_array, is_object, as_integer, as_double, as_bool, as_string,
+// as_string_view and to_json.
+
+template <class Derived, class CharT, class Member>
+class json_view_base
+{
+public:
+    typedef CharT char_type;
+    typedef std::basic_string<CharT> string_type;
+    typedef basic_string_view<CharT> string_view_type;
+    typedef Member member_type;
+
+    class array_iterator
+    {
+        Derived container_;
+        size_t position_;
+    public:
+        typedef Derived value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const Derived* pointer;
+        typedef Derived reference;
+        typedef std::input_iterator_tag iterator_category;
+
+        array_iterator(const Derived& container, size_t position)
+            : container_(container), position_(position)
+        {
+        }
+
+        Derived operator*() const
+        {
+            return container_.element_at(position_);
+        }
+
+        array_iterator& operator++()
+        {
+            position_ = container_.next_element(position_);
+            return *this;
+        }
+
+        array_iterator operator++(int)
+        {
+            array_iterator temp(*this);
+            ++(*this);
+            return temp;
+        }
+
+        friend bool operator==(const array_iterator& lhs, const array_iterator& rhs)
+        {
+            return lhs.position_ == rhs.position_;
+        }
+
+        friend bool operator!=(const array_iterator& lhs, const array_iterator& rhs)
+        {
+            return lhs.position_ != rhs.position_;
+        }
+    };
+
+    class object_iterator
+    {
+        Derived container_;
+        size_t position_;
+    public:
+        typedef Member value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const Member* pointer;
+        typedef Member reference;
+        typedef std::input_iterator_tag iterator_category;
+
+        object_iterator(const Derived& container, size_t position)
+            : container_(container), position_(position)
+        {
+        }
+
+        Member operator*() const
+        {
+            return container_.member_at(position_);
+        }
+
+        object_iterator& operator++()
+        {
+            position_ = container_.next_member(position_);
+            return *this;
+        }
+
+        object_iterator operator++(int)
+        {
+            object_iterator temp(*this);
+            ++(*this);
+            return temp;
+        }
+
+        friend bool operator==(const object_iterator& lhs, const object_iterator& rhs)
+        {
+            return lhs.position_ == rhs.position_;
+        }
+
+        friend bool operator!=(const object_iterator& lhs, const object_iterator& rhs)
+        {
+            return lhs.position_ != rhs.position_;
+        }
+    };
+
+    range<array_iterator> array_range() const
+    {
+        if (!derived().is_array())
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Not an array"));
+        }
+        size_t first, last;
+        derived().element_positions(first, last);
+        return range<array_iterator>(array_iterator(derived(), first), array_iterator(derived(), last));
+    }
+
+    range<object_iterator> object_range() const
+    {
+        if (!derived().is_object())
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Not an object"));
+        }
+        size_t first, last;
+        derived().member_positions(first, last);
+        return range<object_iterator>(object_iterator(derived(), first), object_iterator(derived(), last));
+    }
+
+    bool contains(const string_view_type& name) const
+    {
+        size_t position;
+        return derived().is_object() && derived().find_member(name, position);
+    }
+
+    Derived at(const string_view_type& name) const
+    {
+        if (!derived().is_object())
+        {
+            JSONCONS_THROW(not_an_object(name.data(),name.length()));
+        }
+        size_t position;
+        if (!derived().find_member(name, position))
+        {
+            JSONCONS_THROW(key_not_found(name.data(),name.length()));
+        }
+        return derived().element_at(position);
+    }
+
+    Derived operator[](const string_view_type& name) const
+    {
+        return at(name);
+    }
+
+    Derived operator[](size_t i) const
+    {
+        return derived().at(i);
+    }
+
+    template <class T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_same<T,bool>::value,T>::type
+    as() const
+    {
+        return derived().template as_integer<T>();
+    }
+
+    template <class T>
+    typename std::enable_if<std::is_floating_point<T>::value,T>::type
+    as() const
+    {
+        return static_cast<T>(derived().as_double());
+    }
+
+    template <class T>
+    typename std::enable_if<std::is_same<T,bool>::value,T>::type
+    as() const
+    {
+        return derived().as_bool();
+    }
+
+    template <class T>
+    typename std::enable_if<std::is_same<T,string_type>::value,T>::type
+    as() const
+    {
+        return derived().as_string();
+    }
+
+    template <class T>
+    typename std::enable_if<std::is_same<T,string_view_type>::value,T>::type
+    as() const
+    {
+        return derived().as_string_view();
+    }
+
+    // Other types are converted from a basic_json built from this value
+    template <class T>
+    typename std::enable_if<!std::is_arithmetic<T>::value && !std::is_same<T,string_type>::value &&
+                            !std::is_same<T,string_view_type>::value,T>::type
+    as() const
+    {
+        return derived().to_json().template as<T>();
+    }
+
+private:
+    const Derived& derived() const
+    {
+        return static_cast<const Derived&>(*this);
+    }
+};
+
+}}
+
+#endif
@@ -108,6 +108,42 @@ bool is_uinteger(const CharT* s, size_t length)
     return true;
 }
 
+// SWAR (SIMD within a register) helpers for runs of eight ASCII digits
+
+template <class CharT>
+typename std::enable_if<sizeof(CharT) == sizeof(uint8_t),uint64_t>::type
+load_eight_chars(const CharT* p)
+{
+    // Assembled in little endian order regardless of platform, compilers reduce this to a single load
+    return static_cast<uint64_t>(static_cast<uint8_t>(p[0]))
+         | (static_cast<uint64_t>(static_cast<uint8_t>(p[1])) << 8)
+         | (static_cast<uint64_t>(static_cast<uint8_t>(p[2])) << 16)
+         | (static_cast<uint64_t>(static_cast<uint8_t>(p[3])) << 24)
+         | (static_cast<uint64_t>(static_cast<uint8_t>(p[4])) << 32)
+         | (static_cast<uint64_t>(static_cast<uint8_t>(p[5])) << 40)
+         | (static_cast<uint64_t>(static_cast<uint8_t>(p[6])) << 48)
+         | (static_cast<uint64_t>(static_cast<uint8_t>(p[7])) << 56);
+}
+
+inline
+bool is_eight_digits(uint64_t val)
+{
+    return ((val & 0xF0F0F0F0F0F0F0F0) | (((val + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+}
+
+// Precondition: is_eight_digits(val)
+inline
+uint32_t parse_eight_digits(uint64_t val)
+{
+    const uint64_t mask = 0x000000FF000000FF;
+    const uint64_t mul1 = 0x000F424000000064; // 100 + (1000000ULL << 32)
+    const uint64_t mul2 = 0x0000271000000001; // 1 + (10000ULL << 32)
+    val -= 0x3030303030303030;
+    val = (val * 10) + (val >> 8); // val = (val * 2561) >> 8;
+    val = (((val & mask) * mul1) + (((val >> 16) & mask) * mul2)) >> 32;
+    return static_cast<uint32_t>(val);
+}
+
 // Precondition: s satisfies
 
 // digit
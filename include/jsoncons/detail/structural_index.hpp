@@ -0,0 +1,501 @@
+// Copyright 2019 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_STRUCTURAL_INDEX_HPP
+#define JSONCONS_DETAIL_STRUCTURAL_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory> // std::allocator
+#include <vector>
+#include <type_traits> // std::make_unsigned
+#include <jsoncons/config/jsoncons_config.hpp>
+
+#if defined(JSONCONS_HAS_AVX2)
+#include <immintrin.h>
+#elif defined(JSONCONS_HAS_SSE2)
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace jsoncons { namespace detail {
+
+// bit scanning
+
+inline
+int count_trailing_zeros(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return static_cast<int>(index);
+#else
+    int n = 0;
+    while ((x & 1) == 0)
+    {
+        x >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+inline
+int count_leading_zeros(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, x);
+    return 63 - static_cast<int>(index);
+#else
+    int n = 0;
+    while ((x & (uint64_t(1) << 63)) == 0)
+    {
+        x <<= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+inline
+int popcount(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(x);
+#else
+    int n = 0;
+    for (; x != 0; x &= x - 1)
+    {
+        ++n;
+    }
+    return n;
+#endif
+}
+
+// json_block_masks
+
+// One bit per character of a 64 character block of JSON text
+
+struct json_block_masks
+{
+    uint64_t whitespace;     // ' ', '\t', '\n', '\r'
+    uint64_t cr;             // '\r'
+    uint64_t lf;             // '\n'
+    uint64_t string_special; // '"', '\\' and control characters, which end a run of string content
+};
+
+template <class CharT>
+void classify_json_block(const CharT* p, size_t length, json_block_masks& masks)
+{
+    typedef typename std::make_unsigned<CharT>::type uchar_type;
+
+    masks.whitespace = 0;
+    masks.cr = 0;
+    masks.lf = 0;
+    masks.string_special = 0;
+    for (size_t i = 0; i < length; ++i)
+    {
+        const uint64_t bit = uint64_t(1) << i;
+        switch (p[i])
+        {
+            case ' ':
+                masks.whitespace |= bit;
+                break;
+            case '\t':
+                masks.whitespace |= bit;
+                masks.string_special |= bit;
+                break;
+            case '\r':
+                masks.whitespace |= bit;
+                masks.cr |= bit;
+                masks.string_special |= bit;
+                break;
+            case '\n':
+                masks.whitespace |= bit;
+                masks.lf |= bit;
+                masks.string_special |= bit;
+                break;
+            case '\"':
+            case '\\':
+                masks.string_special |= bit;
+                break;
+            default:
+                if (static_cast<uchar_type>(p[i]) < 0x20)
+                {
+                    masks.string_special |= bit;
+                }
+                break;
+        }
+    }
+}
+
+#if defined(JSONCONS_HAS_AVX2)
+
+inline
+void classify_json_block64(const char* p, json_block_masks& masks)
+{
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i cr = _mm256_set1_epi8('\r');
+    const __m256i lf = _mm256_set1_epi8('\n');
+    const __m256i quote = _mm256_set1_epi8('\"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i max_control = _mm256_set1_epi8(0x1f);
+
+    masks.whitespace = 0;
+    masks.cr = 0;
+    masks.lf = 0;
+    masks.string_special = 0;
+    for (int i = 0; i < 2; ++i)
+    {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32*i));
+        const __m256i is_cr = _mm256_cmpeq_epi8(v, cr);
+        const __m256i is_lf = _mm256_cmpeq_epi8(v, lf);
+        const __m256i is_ws = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, space), _mm256_cmpeq_epi8(v, tab)),
+                                              _mm256_or_si256(is_cr, is_lf));
+        const __m256i is_control = _mm256_cmpeq_epi8(_mm256_max_epu8(v, max_control), max_control);
+        const __m256i is_special = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, quote), _mm256_cmpeq_epi8(v, backslash)),
+                                                   is_control);
+        const int shift = 32*i;
+        masks.whitespace |= uint64_t(static_cast<uint32_t>(_mm256_movemask_epi8(is_ws))) << shift;
+        masks.cr |= uint64_t(static_cast<uint32_t>(_mm256_movemask_epi8(is_cr))) << shift;
+        masks.lf |= uint64_t(static_cast<uint32_t>(_mm256_movemask_epi8(is_lf))) << shift;
+        masks.string_special |= uint64_t(static_cast<uint32_t>(_mm256_movemask_epi8(is_special))) << shift;
+    }
+}
+
+#elif defined(JSONCONS_HAS_SSE2)
+
+inline
+void classify_json_block64(const char* p, json_block_masks& masks)
+{
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i lf = _mm_set1_epi8('\n');
+    const __m128i quote = _mm_set1_epi8('\"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i max_control = _mm_set1_epi8(0x1f);
+
+    masks.whitespace = 0;
+    masks.cr = 0;
+    masks.lf = 0;
+    masks.string_special = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16*i));
+        const __m128i is_cr = _mm_cmpeq_epi8(v, cr);
+        const __m128i is_lf = _mm_cmpeq_epi8(v, lf);
+        const __m128i is_ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab)),
+                                           _mm_or_si128(is_cr, is_lf));
+        const __m128i is_control = _mm_cmpeq_epi8(_mm_max_epu8(v, max_control), max_control);
+        const __m128i is_special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)),
+                                                is_control);
+        const int shift = 16*i;
+        masks.whitespace |= uint64_t(static_cast<uint32_t>(_mm_movemask_epi8(is_ws))) << shift;
+        masks.cr |= uint64_t(static_cast<uint32_t>(_mm_movemask_epi8(is_cr))) << shift;
+        masks.lf |= uint64_t(static_cast<uint32_t>(_mm_movemask_epi8(is_lf))) << shift;
+        masks.string_special |= uint64_t(static_cast<uint32_t>(_mm_movemask_epi8(is_special))) << shift;
+    }
+}
+
+#else
+
+inline
+void classify_json_block64(const char* p, json_block_masks& masks)
+{
+    classify_json_block(p, 64, masks);
+}
+
+#endif
+
+template <class CharT>
+typename std::enable_if<sizeof(CharT) == sizeof(char),void>::type
+classify_full_json_block(const CharT* p, json_block_masks& masks)
+{
+    classify_json_block64(reinterpret_cast<const char*>(p), masks);
+}
+
+template <class CharT>
+typename std::enable_if<sizeof(CharT) != sizeof(char),void>::type
+classify_full_json_block(const CharT* p, json_block_masks& masks)
+{
+    classify_json_block(p, 64, masks);
+}
+
+// find_string_special
+
+// Returns a pointer to the first '"', '\\' or control character in [p,last), or last
+
+template <class CharT>
+const CharT* find_string_special_scalar(const CharT* p, const CharT* last)
+{
+    typedef typename std::make_unsigned<CharT>::type uchar_type;
+
+    for (; p != last; ++p)
+    {
+        if (*p == '\"' || *p == '\\' || static_cast<uchar_type>(*p) < 0x20)
+        {
+            break;
+        }
+    }
+    return p;
+}
+
+template <class CharT>
+typename std::enable_if<sizeof(CharT) != sizeof(char),const CharT*>::type
+find_string_special(const CharT* p, const CharT* last)
+{
+    return find_string_special_scalar(p, last);
+}
+
+template <class CharT>
+typename std::enable_if<sizeof(CharT) == sizeof(char),const CharT*>::type
+find_string_special(const CharT* p, const CharT* last)
+{
+#if defined(JSONCONS_HAS_AVX2)
+    const __m256i quote = _mm256_set1_epi8('\"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i max_control = _mm256_set1_epi8(0x1f);
+    while (last - p >= 32)
+    {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        const __m256i is_special = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, quote), _mm256_cmpeq_epi8(v, backslash)),
+                                                   _mm256_cmpeq_epi8(_mm256_max_epu8(v, max_control), max_control));
+        const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(is_special));
+        if (mask != 0)
+        {
+            return p + count_trailing_zeros(mask);
+        }
+        p += 32;
+    }
+#elif defined(JSONCONS_HAS_SSE2)
+    const __m128i quote = _mm_set1_epi8('\"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i max_control = _mm_set1_epi8(0x1f);
+    while (last - p >= 16)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const __m128i is_special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)),
+                                                _mm_cmpeq_epi8(_mm_max_epu8(v, max_control), max_control));
+        const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(is_special));
+        if (mask != 0)
+        {
+            return p + count_trailing_zeros(mask);
+        }
+        p += 16;
+    }
+#endif
+    return find_string_special_scalar(p, last);
+}
+
+// Decodes four hex digits, returns false if any is not a hex digit
+
+template <class CharT>
+bool decode_hex4(const CharT* p, uint32_t& cp)
+{
+    uint32_t value = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        const CharT c = p[i];
+        uint32_t digit;
+        if (c >= '0' && c <= '9')
+        {
+            digit = static_cast<uint32_t>(c - '0');
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            digit = static_cast<uint32_t>(c - 'a' + 10);
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            digit = static_cast<uint32_t>(c - 'A' + 10);
+        }
+        else
+        {
+            return false;
+        }
+        value = (value << 4) | digit;
+    }
+    cp = value;
+    return true;
+}
+
+// basic_structural_index
+
+// Stage one of two stage parsing. Classifies the characters of an input buffer
+// into bitmaps, 64 characters at a time, so that the parser can jump over
+// whitespace and string content instead of dispatching on each character.
+// The buffer is classified lazily, one window of blocks at a time, so the
+// memory used is bounded however large the buffer.
+
+template <class CharT, class Allocator = std::allocator<char>>
+class basic_structural_index
+{
+    typedef typename std::allocator_traits<Allocator>:: template rebind_alloc<json_block_masks> block_allocator_type;
+
+    static const size_t block_size = 64;
+    static const size_t window_blocks = 256;
+
+    const CharT* data_;
+    size_t length_;
+    size_t window_begin_;
+    std::vector<json_block_masks,block_allocator_type> blocks_;
+public:
+    basic_structural_index(const Allocator& allocator = Allocator())
+        : data_(nullptr), length_(0), window_begin_(0), blocks_(allocator)
+    {
+    }
+
+    void update(const CharT* data, size_t length)
+    {
+        data_ = data;
+        length_ = length;
+        window_begin_ = 0;
+        blocks_.clear();
+    }
+
+    const CharT* data() const
+    {
+        return data_;
+    }
+
+    size_t length() const
+    {
+        return length_;
+    }
+
+    // Returns a pointer to the first non-whitespace character at or after p, or to the end of input,
+    // and advances line and column as the character by character parser would. p must not point
+    // at the '\n' of a "\r\n" pair. A '\r' that is the last character of the input is not skipped,
+    // so that a "\r\n" pair split across buffers is counted once.
+    const CharT* skip_whitespace(const CharT* p, size_t& line, size_t& column)
+    {
+        size_t limit = length_;
+        if (limit > 0 && data_[limit-1] == '\r')
+        {
+            --limit;
+        }
+        const size_t first = p - data_;
+        size_t pos = first;
+        size_t line_breaks = 0;
+        size_t last_break = 0;
+        uint64_t prev_cr = 0;
+
+        while (pos < limit)
+        {
+            const size_t block = pos / block_size;
+            const size_t block_begin = block*block_size;
+            const json_block_masks& masks = get_block(block);
+
+            uint64_t valid = ~uint64_t(0) << (pos - block_begin);
+            if (limit - block_begin < block_size)
+            {
+                valid &= (uint64_t(1) << (limit - block_begin)) - 1;
+            }
+            const uint64_t non_ws = ~masks.whitespace & valid;
+            const uint64_t run = non_ws != 0 ? valid & ((non_ws & (0-non_ws)) - 1) : valid;
+
+            const uint64_t crs = masks.cr & run;
+            const uint64_t lfs = masks.lf & run & ~((crs << 1) | prev_cr);
+            const uint64_t breaks = crs | (masks.lf & run);
+            line_breaks += popcount(crs) + popcount(lfs);
+            if (breaks != 0)
+            {
+                last_break = block_begin + (63 - count_leading_zeros(breaks));
+            }
+            prev_cr = crs >> 63;
+
+            if (non_ws != 0)
+            {
+                pos = block_begin + count_trailing_zeros(non_ws);
+                break;
+            }
+            pos = block_begin + block_size;
+        }
+        if (pos > limit)
+        {
+            pos = limit;
+        }
+
+        if (line_breaks > 0)
+        {
+            line += line_breaks;
+            column = 1 + (pos - (last_break + 1));
+        }
+        else
+        {
+            column += (pos - first);
+        }
+        return data_ + pos;
+    }
+
+    // Returns a pointer to the first '"', '\\' or control character at or after p, or to the end of input
+    const CharT* find_string_special(const CharT* p)
+    {
+        size_t pos = p - data_;
+        while (pos < length_)
+        {
+            const size_t block = pos / block_size;
+            const size_t block_begin = block*block_size;
+            const json_block_masks& masks = get_block(block);
+
+            const uint64_t special = masks.string_special & (~uint64_t(0) << (pos - block_begin));
+            if (special != 0)
+            {
+                pos = block_begin + count_trailing_zeros(special);
+                return pos < length_ ? data_ + pos : data_ + length_;
+            }
+            pos = block_begin + block_size;
+        }
+        return data_ + length_;
+    }
+
+private:
+    const json_block_masks& get_block(size_t block)
+    {
+        if (block < window_begin_ || block >= window_begin_ + blocks_.size())
+        {
+            classify_window(block);
+        }
+        return blocks_[block - window_begin_];
+    }
+
+    void classify_window(size_t block)
+    {
+        const size_t num_blocks = (length_ + block_size - 1) / block_size;
+        size_t count = num_blocks - block;
+        if (count > window_blocks)
+        {
+            count = window_blocks;
+        }
+        window_begin_ = block;
+        blocks_.resize(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const size_t offset = (block + i)*block_size;
+            if (length_ - offset >= block_size)
+            {
+                classify_full_json_block(data_ + offset, blocks_[i]);
+            }
+            else
+            {
+                classify_json_block(data_ + offset, length_ - offset, blocks_[i]);
+            }
+        }
+    }
+};
+
+}}
+
+#endif
@@ -189,6 +189,24 @@ template <class T>
 struct is_floating_point_like<T, 
                               typename std::enable_if<std::is_floating_point<T>::value>::type> : std::true_type {};
 
+// is_hash_indexed_policy
+
+template <class T, class Enable=void>
+struct is_hash_indexed_policy : std::false_type {};
+
+template <class T>
+struct is_hash_indexed_policy<T, 
+                              typename std::enable_if<T::hash_index>::type> : std::true_type {};
+
+// is_compact_policy
+
+template <class T, class Enable=void>
+struct is_compact_policy : std::false_type {};
+
+template <class T>
+struct is_compact_policy<T, 
+                         typename std::enable_if<T::compact>::type> : std::true_type {};
+
 // is_map_like
 
 template <class T, class Enable=void>
@@ -199,6 +217,18 @@ struct is_map_like<T,
                    typename std::enable_if<!std::is_void<typename T::mapped_type>::value>::type> 
     : std::true_type {};
 
+// has_node_extract, for maps with C++17 node handles
+
+template <class T, class Enable=void>
+struct has_node_extract : std::false_type {};
+
+template <class T>
+struct has_node_extract<T, 
+                        typename std::enable_if<!std::is_void<typename T::node_type>::value &&
+                                                !std::is_void<decltype(std::declval<T&>().extract(std::declval<typename T::iterator>()))>::value
+>::type> 
+    : std::true_type {};
+
 // is_array_like
 template<class T>
 struct is_array_like : std::false_type {};
@@ -81,6 +81,66 @@ T decode_json(const basic_json<CharT,ImplementationPolicy,Allocator>& j,
     return val;
 }
 
+// decode_json_into
+
+template <class T, class CharT>
+typename std::enable_if<is_basic_json_class<T>::value>::type
+decode_json_into(T& val,
+                 const std::basic_string<CharT>& s,
+                 const basic_json_decode_options<CharT>& options = basic_json_options<CharT>::get_default_options())
+{
+    val = decode_json<T>(s, options);
+}
+
+template <class T, class CharT>
+typename std::enable_if<!is_basic_json_class<T>::value>::type
+decode_json_into(T& val,
+                 const std::basic_string<CharT>& s,
+                 const basic_json_decode_options<CharT>& options = basic_json_options<CharT>::get_default_options())
+{
+    basic_json_cursor<CharT> reader(s, options);
+    read_into(basic_json<CharT>(), reader, val);
+}
+
+template <class T, class CharT>
+typename std::enable_if<is_basic_json_class<T>::value>::type
+decode_json_into(T& val,
+                 std::basic_istream<CharT>& is,
+                 const basic_json_decode_options<CharT>& options = basic_json_options<CharT>::get_default_options())
+{
+    val = decode_json<T>(is, options);
+}
+
+template <class T, class CharT>
+typename std::enable_if<!is_basic_json_class<T>::value>::type
+decode_json_into(T& val,
+                 std::basic_istream<CharT>& is,
+                 const basic_json_decode_options<CharT>& options = basic_json_options<CharT>::get_default_options())
+{
+    basic_json_cursor<CharT> reader(is, options);
+    read_into(basic_json<CharT>(), reader, val);
+}
+
+template <class T, class CharT, class ImplementationPolicy, class Allocator>
+void decode_json_into(const basic_json<CharT,ImplementationPolicy,Allocator>& j,
+                      T& val,
+                      const std::basic_string<CharT>& s,
+                      const basic_json_decode_options<CharT>& options = basic_json_options<CharT>::get_default_options())
+{
+    basic_json_cursor<CharT> reader(s, options);
+    read_into(j, reader, val);
+}
+
+template <class T, class CharT, class ImplementationPolicy, class Allocator>
+void decode_json_into(const basic_json<CharT,ImplementationPolicy,Allocator>& j,
+                      T& val,
+                      std::basic_istream<CharT>& is,
+                      const basic_json_decode_options<CharT>& options = basic_json_options<CharT>::get_default_options())
+{
+    basic_json_cursor<CharT> reader(is, options);
+    read_into(j, reader, val);
+}
+
 // encode_json
 
 template <class T, class CharT>
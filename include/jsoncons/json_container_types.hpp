@@ -21,6 +21,7 @@
 #include <type_traits> // std::enable_if
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_type_traits.hpp>
+#include <jsoncons/detail/hash.hpp>
 
 namespace jsoncons {
 
@@ -740,17 +741,21 @@ public:
             size_t count = std::distance(first,last);
             members_.reserve(members_.size() + count);
 
-            auto it = find(convert(*first).key());
+            auto s = first;
+            key_value_type kv = convert(*s);
+            auto it = find(kv.key());
             if (it != members_.end())
             {
-                for (auto s = first; s != last; ++s)
+                it = members_.emplace(it, std::move(kv));
+                for (++s; s != last; ++s)
                 {
                     it = members_.emplace(it, convert(*s));
                 }
             }
             else
             {
-                for (auto s = first; s != last; ++s)
+                members_.emplace_back(std::move(kv));
+                for (++s; s != last; ++s)
                 {
                     members_.emplace_back(convert(*s));
                 }
@@ -1166,7 +1171,8 @@ private:
 
 // Preserve order
 template <class KeyT,class Json>
-class json_object<KeyT,Json,typename std::enable_if<Json::implementation_policy::preserve_order>::type> :
+class json_object<KeyT,Json,typename std::enable_if<Json::implementation_policy::preserve_order &&
+                                                    !jsoncons::detail::is_hash_indexed_policy<typename Json::implementation_policy>::value>::type> :
     public container_base<typename Json::allocator_type>
 {
 public:
@@ -1237,30 +1243,7 @@ public:
         {
             members_.emplace_back(get_key_value<KeyT,Json>()(*s));
         }
-
-        build_index();
-        auto last_unique = std::unique(index_.begin(), index_.end(),
-            [&](size_t a, size_t b) { return !(members_.at(a).key().compare(members_.at(b).key())); });
-
-        if (last_unique != index_.end())
-        {
-            index_.erase(last_unique, index_.end());
-            std::sort(index_.begin(), index_.end());
-
-            auto result = index_.rbegin();
-            if (*result != members_.size())
-            {
-                members_.erase(members_.begin() + (*result + 1), members_.end());
-            }
-            for (auto it = index_.rbegin() + 1; it != index_.rend(); ++it, ++result)
-            {
-                if (*result - *it > 1)
-                {
-                    members_.erase(members_.begin() + (*it + 1), members_.begin() + *result);
-                }
-            }
-        }
-        build_index();
+        index_new_members(0);
     }
 
     template<class InputIt>
@@ -1276,30 +1259,7 @@ public:
         {
             members_.emplace_back(get_key_value<KeyT,Json>()(*s));
         }
-
-        build_index();
-        auto last_unique = std::unique(index_.begin(), index_.end(),
-            [&](size_t a, size_t b) { return !(members_.at(a).key().compare(members_.at(b).key())); });
-
-        if (last_unique != index_.end())
-        {
-            index_.erase(last_unique, index_.end());
-            std::sort(index_.begin(), index_.end());
-
-            auto result = index_.rbegin();
-            if (*result != members_.size())
-            {
-                members_.erase(members_.begin() + (*result + 1), members_.end());
-            }
-            for (auto it = index_.rbegin() + 1; it != index_.rend(); ++it, ++result)
-            {
-                if (*result - *it > 1)
-                {
-                    members_.erase(members_.begin() + (*it + 1), members_.begin() + *result);
-                }
-            }
-        }
-        build_index();
+        index_new_members(0);
     }
 
     json_object(std::initializer_list<typename Json::array> init)
@@ -1341,6 +1301,7 @@ public:
     void swap(json_object& val) noexcept
     {
         members_.swap(val.members_);
+        index_.swap(val.index_);
     }
 
     iterator begin()
@@ -1447,7 +1408,6 @@ public:
 #else
             members_.erase(first,last);
 #endif
-            //build_index();
         }
     }
 
@@ -1473,49 +1433,26 @@ public:
     void insert(InputIt first, InputIt last, Convert convert)
     {
         size_t count = std::distance(first,last);
-        members_.reserve(members_.size() + count);
+        size_t pos = members_.size();
+        members_.reserve(pos + count);
         for (auto s = first; s != last; ++s)
         {
             members_.emplace_back(convert(*s));
         }
-
-        build_index();
-        auto last_unique = std::unique(index_.begin(), index_.end(),
-            [&](size_t a, size_t b) { return !(members_.at(a).key().compare(members_.at(b).key())); });
-
-        if (last_unique != index_.end())
-        {
-            index_.erase(last_unique, index_.end());
-            std::sort(index_.begin(), index_.end());
-
-            auto result = index_.rbegin();
-            if (*result != members_.size())
-            {
-                members_.erase(members_.begin() + (*result + 1), members_.end());
-            }
-            for (auto it = index_.rbegin() + 1; it != index_.rend(); ++it, ++result)
-            {
-                if (*result - *it > 1)
-                {
-                    members_.erase(members_.begin() + (*it + 1), members_.begin() + *result);
-                }
-            }
-        }
-        build_index();
+        index_new_members(pos);
     }
 
     template<class InputIt, class Convert>
     void insert(sorted_unique_range_tag, InputIt first, InputIt last, Convert convert)
     {
         size_t count = std::distance(first,last);
-
-        members_.reserve(members_.size() + count);
+        size_t pos = members_.size();
+        members_.reserve(pos + count);
         for (auto s = first; s != last; ++s)
         {
             members_.emplace_back(convert(*s));
         }
-
-        build_index();
+        index_new_members(pos);
     }
 
     template <class T, class A=allocator_type>
@@ -1861,38 +1798,22 @@ private:
         auto it = std::lower_bound(index_.begin(),index_.end(), key, 
                                     [&](size_t i, const string_view_type& k) -> bool {return string_view_type(members_.at(i).key()).compare(k) < 0;});        
 
-        if (it == index_.end())
+        if (it != index_.end() && members_.at(*it).key() == key)
         {
-            size_t count = index_.size() - pos;
-            for (size_t i = 0; count > 0 && i < index_.size(); ++i)
-            {
-                if (index_[i] >= pos)
-                {
-                    ++index_[i];
-                    --count;
-                }
-            }
-            index_.push_back(pos);
-            return std::make_pair(pos,true);
+            return std::make_pair(*it,false);
         }
-        else if (members_.at(*it).key() != key)
+        if (pos < index_.size())
         {
-            size_t count = index_.size() - pos;
-            for (size_t i = 0; count > 0 && i < index_.size(); ++i)
+            for (auto& i : index_)
             {
-                if (index_[i] >= pos)
+                if (i >= pos)
                 {
-                    ++index_[i];
-                    --count;
+                    ++i;
                 }
             }
-            auto it2 = index_.insert(it, pos);
-            return std::make_pair(*it2,true);
-        }
-        else
-        {
-            return std::make_pair(*it,false);
         }
+        index_.insert(it, pos);
+        return std::make_pair(pos,true);
     }
 
     void erase_index_entries(size_t pos1, size_t pos2)
@@ -1901,39 +1822,846 @@ private:
         JSONCONS_ASSERT(pos2 <= index_.size());
 
         const size_t offset = pos2 - pos1;
-        const size_t n = index_.size() - offset;
-        for (size_t i = 0; i < index_.size(); ++i)
+        if (offset == index_.size())
+        {
+            index_.clear();
+            return;
+        }
+        auto last = std::remove_if(index_.begin(), index_.end(), 
+                                   [&](size_t i) -> bool {return i >= pos1 && i < pos2;});
+        index_.erase(last, index_.end());
+        for (auto& i : index_)
+        {
+            if (i >= pos2)
+            {
+                i -= offset;
+            }
+        }
+    }
+
+    // Merges the positions of members_[pos..] into the index, and removes 
+    // those members whose keys are already present, keeping the first
+    void index_new_members(size_t pos)
+    {
+        JSONCONS_ASSERT(pos == index_.size());
+
+        const size_t n = members_.size();
+        if (pos == n)
+        {
+            return;
+        }
+        auto less = [&](size_t a, size_t b) -> bool {return members_[a].key().compare(members_[b].key()) < 0;};
+
+        index_.reserve(n);
+        for (size_t i = pos; i < n; ++i)
+        {
+            index_.push_back(i);
+        }
+        std::stable_sort(index_.begin() + pos, index_.end(), less);
+        std::inplace_merge(index_.begin(), index_.begin() + pos, index_.end(), less);
+
+        auto last_unique = std::unique(index_.begin(), index_.end(),
+            [&](size_t a, size_t b) -> bool {return members_[a].key() == members_[b].key();});
+        if (last_unique == index_.end())
+        {
+            return;
+        }
+        index_.erase(last_unique, index_.end());
+
+        // Duplicates are all at or after pos, compact them out and renumber
+        const size_t npos = (size_t)-1;
+        index_container_type positions(n - pos, npos, index_.get_allocator());
+        for (size_t i : index_)
         {
-            if (offset == index_.size())
+            if (i >= pos)
             {
-                index_.erase(index_.begin()+i,index_.end());
-                i += offset;
+                positions[i - pos] = 0;
             }
-            else if (index_[i] >= pos1 && index_[i] < pos2)
+        }
+        size_t count = pos;
+        for (size_t i = pos; i < n; ++i)
+        {
+            if (positions[i - pos] != npos)
             {
-                index_.erase(index_.begin()+i);
+                positions[i - pos] = count;
+                if (count != i)
+                {
+                    members_[count] = std::move(members_[i]);
+                }
+                ++count;
             }
         }
-        for (size_t i = 0; i < index_.size(); ++i)
+        members_.erase(members_.begin() + count, members_.end());
+        for (auto& i : index_)
         {
-            if (index_[i] >= pos2)
+            if (i >= pos)
             {
-                index_[i] -= offset;
+                i = positions[i - pos];
             }
         }
-        JSONCONS_ASSERT(index_.size() == n);
     }
 
-    void build_index()
+    json_object& operator=(const json_object&) = delete;
+};
+
+// Preserve order, with an open addressing hash index over the members
+template <class KeyT,class Json>
+class json_object<KeyT,Json,typename std::enable_if<jsoncons::detail::is_hash_indexed_policy<typename Json::implementation_policy>::value>::type> :
+    public container_base<typename Json::allocator_type>
+{
+public:
+    typedef typename Json::allocator_type allocator_type;
+    typedef typename Json::char_type char_type;
+    typedef KeyT key_type;
+    typedef typename Json::string_view_type string_view_type;
+    typedef key_value<KeyT,Json> key_value_type;
+private:
+    struct bucket
+    {
+        size_t hash;
+        size_t pos;
+    };
+
+    static constexpr size_t npos = (size_t)-1;
+    // Objects of up to this many members are searched linearly and have no index
+    static constexpr size_t linear_search_threshold = 8;
+
+    typedef typename Json::implementation_policy implementation_policy;
+    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<key_value_type> key_value_allocator_type;
+    using key_value_container_type = typename implementation_policy::template sequence_container_type<key_value_type,key_value_allocator_type>;
+    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<bucket> bucket_allocator_type;
+    using bucket_container_type = typename implementation_policy::template sequence_container_type<bucket,bucket_allocator_type>;
+
+    key_value_container_type members_;
+    bucket_container_type buckets_;
+public:
+    typedef typename key_value_container_type::iterator iterator;
+    typedef typename key_value_container_type::const_iterator const_iterator;
+
+    using container_base<allocator_type>::get_allocator;
+
+    json_object()
+    {
+    }
+    json_object(const allocator_type& allocator)
+        : container_base<allocator_type>(allocator), 
+          members_(key_value_allocator_type(allocator)), 
+          buckets_(bucket_allocator_type(allocator))
+    {
+    }
+
+    json_object(const json_object& val)
+        : container_base<allocator_type>(val.get_allocator()), 
+          members_(val.members_),
+          buckets_(val.buckets_)
+    {
+    }
+
+    json_object(json_object&& val)
+        : container_base<allocator_type>(val.get_allocator()), 
+          members_(std::move(val.members_)),
+          buckets_(std::move(val.buckets_))
+    {
+    }
+
+    json_object(const json_object& val, const allocator_type& allocator) 
+        : container_base<allocator_type>(allocator), 
+          members_(val.members_,key_value_allocator_type(allocator)),
+          buckets_(val.buckets_,bucket_allocator_type(allocator))
+    {
+    }
+
+    json_object(json_object&& val,const allocator_type& allocator) 
+        : container_base<allocator_type>(allocator), 
+          members_(std::move(val.members_),key_value_allocator_type(allocator)),
+          buckets_(std::move(val.buckets_),bucket_allocator_type(allocator))
+    {
+    }
+
+    template<class InputIt>
+    json_object(InputIt first, InputIt last)
+    {
+        insert(first, last, get_key_value<KeyT,Json>());
+    }
+
+    template<class InputIt>
+    json_object(InputIt first, InputIt last, 
+                const allocator_type& allocator)
+        : container_base<allocator_type>(allocator), 
+          members_(key_value_allocator_type(allocator)), 
+          buckets_(bucket_allocator_type(allocator))
+    {
+        insert(first, last, get_key_value<KeyT,Json>());
+    }
+
+    json_object(std::initializer_list<typename Json::array> init)
+    {
+        for (const auto& element : init)
+        {
+            if (element.size() != 2 || !element[0].is_string())
+            {
+                JSONCONS_THROW(json_runtime_error<std::runtime_error>("Cannot create object from initializer list"));
+                break;
+            }
+        }
+        for (auto& element : init)
+        {
+            insert_or_assign(element[0].as_string_view(), std::move(element[1]));
+        }
+    }
+
+    json_object(std::initializer_list<typename Json::array> init, 
+                const allocator_type& allocator)
+        : container_base<allocator_type>(allocator), 
+          members_(key_value_allocator_type(allocator)), 
+          buckets_(bucket_allocator_type(allocator))
+    {
+        for (const auto& element : init)
+        {
+            if (element.size() != 2 || !element[0].is_string())
+            {
+                JSONCONS_THROW(json_runtime_error<std::runtime_error>("Cannot create object from initializer list"));
+                break;
+            }
+        }
+        for (auto& element : init)
+        {
+            insert_or_assign(element[0].as_string_view(), std::move(element[1]));
+        }
+    }
+
+    void swap(json_object& val) noexcept
+    {
+        members_.swap(val.members_);
+        buckets_.swap(val.buckets_);
+    }
+
+    iterator begin()
+    {
+        return members_.begin();
+    }
+
+    iterator end()
+    {
+        return members_.end();
+    }
+
+    const_iterator begin() const
+    {
+        return members_.begin();
+    }
+
+    const_iterator end() const
+    {
+        return members_.end();
+    }
+
+    size_t size() const {return members_.size();}
+
+    size_t capacity() const {return members_.capacity();}
+
+    void clear() 
+    {
+        members_.clear();
+        buckets_.clear();
+    }
+
+    void shrink_to_fit() 
     {
-        index_.clear();
-        index_.reserve(members_.size());
         for (size_t i = 0; i < members_.size(); ++i)
         {
-            index_.push_back(i);
+            members_[i].shrink_to_fit();
+        }
+        members_.shrink_to_fit();
+        buckets_.shrink_to_fit();
+    }
+
+    void reserve(size_t n) {members_.reserve(n);}
+
+    Json& at(size_t i) 
+    {
+        if (i >= members_.size())
+        {
+            JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+        }
+        return members_[i].value();
+    }
+
+    const Json& at(size_t i) const 
+    {
+        if (i >= members_.size())
+        {
+            JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+        }
+        return members_[i].value();
+    }
+
+    iterator find(const string_view_type& name) noexcept
+    {
+        size_t pos = find_position(name, hash_key(name));
+        return pos == npos ? members_.end() : members_.begin() + pos;
+    }
+
+    const_iterator find(const string_view_type& name) const noexcept
+    {
+        size_t pos = find_position(name, hash_key(name));
+        return pos == npos ? members_.end() : members_.begin() + pos;
+    }
+
+    void erase(const_iterator first, const_iterator last) 
+    {
+        size_t pos1 = first == members_.end() ? members_.size() : first - members_.begin();
+        size_t pos2 = last == members_.end() ? members_.size() : last - members_.begin();
+
+        if (pos1 < members_.size() && pos2 <= members_.size())
+        {
+            erase_index_entries(pos1, pos2);
+#if defined(JSONCONS_NO_ERASE_TAKING_CONST_ITERATOR)
+            iterator it1 = members_.begin() + (first - members_.begin());
+            iterator it2 = members_.begin() + (last - members_.begin());
+            members_.erase(it1,it2);
+#else
+            members_.erase(first,last);
+#endif
+        }
+    }
+
+    void erase(const string_view_type& name) 
+    {
+        size_t pos = find_position(name, hash_key(name));
+        if (pos != npos)
+        {
+            erase_index_entries(pos, pos + 1);
+            members_.erase(members_.begin() + pos);
+        }
+    }
+
+    template<class InputIt, class Convert>
+    void insert(InputIt first, InputIt last, Convert convert)
+    {
+        size_t count = std::distance(first,last);
+        members_.reserve(members_.size() + count);
+        for (auto s = first; s != last; ++s)
+        {
+            key_value_type kv = convert(*s);
+            size_t hash = hash_key(kv.key());
+            if (find_position(kv.key(), hash) == npos)
+            {
+                members_.emplace_back(std::move(kv));
+                append_index_entry(hash);
+            }
+        }
+    }
+
+    template<class InputIt, class Convert>
+    void insert(sorted_unique_range_tag, InputIt first, InputIt last, Convert convert)
+    {
+        size_t count = std::distance(first,last);
+
+        members_.reserve(members_.size() + count);
+        for (auto s = first; s != last; ++s)
+        {
+            members_.emplace_back(convert(*s));
+            append_index_entry(hash_key(members_.back().key()));
+        }
+    }
+
+    template <class T, class A=allocator_type>
+    typename std::enable_if<is_stateless<A>::value,std::pair<iterator,bool>>::type
+    insert_or_assign(const string_view_type& name, T&& value)
+    {
+        size_t hash = hash_key(name);
+        size_t pos = find_position(name, hash);
+        if (pos == npos)
+        {
+            members_.emplace_back(key_type(name.begin(), name.end()), std::forward<T>(value));
+            append_index_entry(hash);
+            return std::make_pair(members_.begin() + (members_.size() - 1),true);
+        }
+        else
+        {
+            auto it = members_.begin() + pos;
+            it->value(Json(std::forward<T>(value)));
+            return std::make_pair(it,false);
+        }
+    }
+
+    template <class T, class A=allocator_type>
+    typename std::enable_if<!is_stateless<A>::value,std::pair<iterator,bool>>::type
+    insert_or_assign(const string_view_type& name, T&& value)
+    {
+        size_t hash = hash_key(name);
+        size_t pos = find_position(name, hash);
+        if (pos == npos)
+        {
+            members_.emplace_back(key_type(name.begin(),name.end(),get_allocator()), 
+                                  std::forward<T>(value),get_allocator());
+            append_index_entry(hash);
+            return std::make_pair(members_.begin() + (members_.size() - 1),true);
+        }
+        else
+        {
+            auto it = members_.begin() + pos;
+            it->value(Json(std::forward<T>(value),get_allocator()));
+            return std::make_pair(it,false);
+        }
+    }
+
+    template <class A=allocator_type, class T>
+    typename std::enable_if<is_stateless<A>::value,iterator>::type 
+    insert_or_assign(iterator hint, const string_view_type& key, T&& value)
+    {
+        if (hint == members_.end())
+        {
+            auto result = insert_or_assign(key, std::forward<T>(value));
+            return result.first;
+        }
+        else
+        {
+            size_t hash = hash_key(key);
+            size_t pos = find_position(key, hash);
+            if (pos == npos)
+            {
+                auto it = members_.emplace(hint, key_type(key.begin(), key.end()), std::forward<T>(value));
+                insert_index_entry(hash, it - members_.begin());
+                return it;
+            }
+            else
+            {
+                auto it = members_.begin() + pos;
+                it->value(Json(std::forward<T>(value)));
+                return it;
+            }
+        }
+    }
+
+    template <class A=allocator_type, class T>
+    typename std::enable_if<!is_stateless<A>::value,iterator>::type 
+    insert_or_assign(iterator hint, const string_view_type& key, T&& value)
+    {
+        if (hint == members_.end())
+        {
+            auto result = insert_or_assign(key, std::forward<T>(value));
+            return result.first;
+        }
+        else
+        {
+            size_t hash = hash_key(key);
+            size_t pos = find_position(key, hash);
+            if (pos == npos)
+            {
+                auto it = members_.emplace(hint, 
+                                           key_type(key.begin(),key.end(),get_allocator()), 
+                                           std::forward<T>(value),get_allocator());
+                insert_index_entry(hash, it - members_.begin());
+                return it;
+            }
+            else
+            {
+                auto it = members_.begin() + pos;
+                it->value(Json(std::forward<T>(value),get_allocator()));
+                return it;
+            }
+        }
+    }
+
+    // merge
+
+    void merge(const json_object& source)
+    {
+        for (auto it = source.begin(); it != source.end(); ++it)
+        {
+            try_emplace(it->key(),it->value());
+        }
+    }
+
+    void merge(json_object&& source)
+    {
+        auto it = std::make_move_iterator(source.begin());
+        auto end = std::make_move_iterator(source.end());
+        for (; it != end; ++it)
+        {
+            auto pos = find(it->key());
+            if (pos == members_.end() )
+            {
+                try_emplace(it->key(),std::move(it->value()));
+            }
+        }
+    }
+
+    void merge(iterator hint, const json_object& source)
+    {
+        size_t pos = hint - members_.begin();
+        for (auto it = source.begin(); it != source.end(); ++it)
+        {
+            hint = try_emplace(hint, it->key(),it->value());
+            size_t newpos = hint - members_.begin();
+            if (newpos == pos)
+            {
+                ++hint;
+                pos = hint - members_.begin();
+            }
+            else
+            {
+                hint = members_.begin() + pos;
+            }
+        }
+    }
+
+    void merge(iterator hint, json_object&& source)
+    {
+        size_t pos = hint - members_.begin();
+
+        auto it = std::make_move_iterator(source.begin());
+        auto end = std::make_move_iterator(source.end());
+        for (; it != end; ++it)
+        {
+            hint = try_emplace(hint, it->key(), std::move(it->value()));
+            size_t newpos = hint - members_.begin();
+            if (newpos == pos)
+            {
+                ++hint;
+                pos = hint - members_.begin();
+            }
+            else
+            {
+                hint = members_.begin() + pos;
+            }
+        }
+    }
+
+    // merge_or_update
+
+    void merge_or_update(const json_object& source)
+    {
+        for (auto it = source.begin(); it != source.end(); ++it)
+        {
+            insert_or_assign(it->key(),it->value());
+        }
+    }
+
+    void merge_or_update(json_object&& source)
+    {
+        auto it = std::make_move_iterator(source.begin());
+        auto end = std::make_move_iterator(source.end());
+        for (; it != end; ++it)
+        {
+            auto pos = find(it->key());
+            if (pos == members_.end() )
+            {
+                insert_or_assign(it->key(),std::move(it->value()));
+            }
+            else
+            {
+                pos->value(std::move(it->value()));
+            }
+        }
+    }
+
+    void merge_or_update(iterator hint, const json_object& source)
+    {
+        size_t pos = hint - members_.begin();
+        for (auto it = source.begin(); it != source.end(); ++it)
+        {
+            hint = insert_or_assign(hint, it->key(),it->value());
+            size_t newpos = hint - members_.begin();
+            if (newpos == pos)
+            {
+                ++hint;
+                pos = hint - members_.begin();
+            }
+            else
+            {
+                hint = members_.begin() + pos;
+            }
+        }
+    }
+
+    void merge_or_update(iterator hint, json_object&& source)
+    {
+        size_t pos = hint - members_.begin();
+        auto it = std::make_move_iterator(source.begin());
+        auto end = std::make_move_iterator(source.end());
+        for (; it != end; ++it)
+        {
+            hint = insert_or_assign(hint, it->key(),std::move(it->value()));
+            size_t newpos = hint - members_.begin();
+            if (newpos == pos)
+            {
+                ++hint;
+                pos = hint - members_.begin();
+            }
+            else
+            {
+                hint = members_.begin() + pos;
+            }
+        }
+    }
+
+    // try_emplace
+
+    template <class A=allocator_type, class... Args>
+    typename std::enable_if<is_stateless<A>::value,std::pair<iterator,bool>>::type
+    try_emplace(const string_view_type& name, Args&&... args)
+    {
+        size_t hash = hash_key(name);
+        size_t pos = find_position(name, hash);
+        if (pos == npos)
+        {
+            members_.emplace_back(key_type(name.begin(), name.end()), std::forward<Args>(args)...);
+            append_index_entry(hash);
+            return std::make_pair(members_.begin() + (members_.size() - 1),true);
+        }
+        else
+        {
+            return std::make_pair(members_.begin() + pos,false);
+        }
+    }
+
+    template <class A=allocator_type, class... Args>
+    typename std::enable_if<!is_stateless<A>::value,std::pair<iterator,bool>>::type
+    try_emplace(const string_view_type& key, Args&&... args)
+    {
+        size_t hash = hash_key(key);
+        size_t pos = find_position(key, hash);
+        if (pos == npos)
+        {
+            members_.emplace_back(key_type(key.begin(),key.end(), get_allocator()), 
+                                  std::forward<Args>(args)...);
+            append_index_entry(hash);
+            return std::make_pair(members_.begin() + (members_.size() - 1),true);
+        }
+        else
+        {
+            return std::make_pair(members_.begin() + pos,false);
+        }
+    }
+ 
+    template <class A=allocator_type, class ... Args>
+    typename std::enable_if<is_stateless<A>::value,iterator>::type
+    try_emplace(iterator hint, const string_view_type& key, Args&&... args)
+    {
+        if (hint == members_.end())
+        {
+            auto result = try_emplace(key, std::forward<Args>(args)...);
+            return result.first;
+        }
+        else
+        {
+            size_t hash = hash_key(key);
+            size_t pos = find_position(key, hash);
+            if (pos == npos)
+            {
+                auto it = members_.emplace(hint, key_type(key.begin(), key.end()), std::forward<Args>(args)...);
+                insert_index_entry(hash, it - members_.begin());
+                return it;
+            }
+            else
+            {
+                return members_.begin() + pos;
+            }
+        }
+    }
+
+    template <class A=allocator_type, class ... Args>
+    typename std::enable_if<!is_stateless<A>::value,iterator>::type
+    try_emplace(iterator hint, const string_view_type& key, Args&&... args)
+    {
+        if (hint == members_.end())
+        {
+            auto result = try_emplace(key, std::forward<Args>(args)...);
+            return result.first;
+        }
+        else
+        {
+            size_t hash = hash_key(key);
+            size_t pos = find_position(key, hash);
+            if (pos == npos)
+            {
+                auto it = members_.emplace(hint, 
+                                           key_type(key.begin(),key.end(), get_allocator()), 
+                                           std::forward<Args>(args)...);
+                insert_index_entry(hash, it - members_.begin());
+                return it;
+            }
+            else
+            {
+                return members_.begin() + pos;
+            }
+        }
+    }
+
+    bool operator==(const json_object& rhs) const
+    {
+        return members_ == rhs.members_;
+    }
+ 
+    bool operator<(const json_object& rhs) const
+    {
+        return members_ < rhs.members_;
+    }
+private:
+
+    static size_t hash_key(const string_view_type& key) noexcept
+    {
+        return jsoncons::detail::fnv1a_hash(key.data(), key.length());
+    }
+
+    size_t find_position(const string_view_type& key, size_t hash) const noexcept
+    {
+        if (buckets_.empty())
+        {
+            for (size_t i = 0; i < members_.size(); ++i)
+            {
+                if (members_[i].key() == key)
+                {
+                    return i;
+                }
+            }
+            return npos;
+        }
+        const size_t mask = buckets_.size() - 1;
+        for (size_t i = hash & mask; ; i = (i + 1) & mask)
+        {
+            const bucket& b = buckets_[i];
+            if (b.pos == npos)
+            {
+                return npos;
+            }
+            if (b.hash == hash && members_[b.pos].key() == key)
+            {
+                return b.pos;
+            }
+        }
+    }
+
+    void insert_bucket(size_t hash, size_t pos) noexcept
+    {
+        const size_t mask = buckets_.size() - 1;
+        size_t i = hash & mask;
+        while (buckets_[i].pos != npos)
+        {
+            i = (i + 1) & mask;
+        }
+        buckets_[i].hash = hash;
+        buckets_[i].pos = pos;
+    }
+
+    // Removes the bucket of the member at pos, moving later entries of its probe
+    // sequence back so that lookups do not stop short at the emptied bucket
+    void erase_bucket(size_t hash, size_t pos) noexcept
+    {
+        const size_t mask = buckets_.size() - 1;
+        size_t i = hash & mask;
+        while (buckets_[i].pos != pos)
+        {
+            i = (i + 1) & mask;
+        }
+        for (size_t j = (i + 1) & mask; buckets_[j].pos != npos; j = (j + 1) & mask)
+        {
+            const size_t home = buckets_[j].hash & mask;
+            const bool stays = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+            if (!stays)
+            {
+                buckets_[i] = buckets_[j];
+                i = j;
+            }
+        }
+        buckets_[i].pos = npos;
+    }
+
+    // Indexes the member just appended to members_
+    void append_index_entry(size_t hash)
+    {
+        insert_index_entry(hash, members_.size() - 1);
+    }
+
+    // Indexes the member just inserted at pos, renumbering the members after it
+    void insert_index_entry(size_t hash, size_t pos)
+    {
+        const size_t n = members_.size();
+        if (n <= linear_search_threshold)
+        {
+            return;
+        }
+        if (buckets_.empty())
+        {
+            build_index();
+            return;
+        }
+        if (pos + 1 < n)
+        {
+            for (auto& b : buckets_)
+            {
+                if (b.pos != npos && b.pos >= pos)
+                {
+                    ++b.pos;
+                }
+            }
+        }
+        if (n*4 > buckets_.size()*3)
+        {
+            bucket_container_type old(buckets_.size()*2, bucket{0,npos}, buckets_.get_allocator());
+            buckets_.swap(old);
+            for (const auto& b : old)
+            {
+                if (b.pos != npos)
+                {
+                    insert_bucket(b.hash, b.pos);
+                }
+            }
+        }
+        insert_bucket(hash, pos);
+    }
+
+    // Unindexes the members [first,last) before they are erased, renumbering the members after them
+    void erase_index_entries(size_t first, size_t last)
+    {
+        const size_t n = members_.size();
+        const size_t count = last - first;
+        if (buckets_.empty() || count == 0)
+        {
+            return;
+        }
+        if (n - count <= linear_search_threshold)
+        {
+            buckets_.clear();
+            return;
+        }
+        for (size_t i = first; i < last; ++i)
+        {
+            erase_bucket(hash_key(members_[i].key()), i);
+        }
+        if (last < n)
+        {
+            for (auto& b : buckets_)
+            {
+                if (b.pos != npos && b.pos >= last)
+                {
+                    b.pos -= count;
+                }
+            }
+        }
+    }
+
+    void build_index()
+    {
+        const size_t n = members_.size();
+        if (n <= linear_search_threshold)
+        {
+            buckets_.clear();
+            return;
+        }
+        size_t capacity = 16;
+        while (n*4 > capacity*3)
+        {
+            capacity *= 2;
+        }
+        buckets_.assign(capacity, bucket{0,npos});
+        for (size_t i = 0; i < n; ++i)
+        {
+            insert_bucket(hash_key(members_[i].key()), i);
         }
-        std::stable_sort(index_.begin(),index_.end(),
-                         [&](size_t a, size_t b) -> bool {return members_.at(a).key().compare(members_.at(b).key()) < 0;});
     }
 
     json_object& operator=(const json_object&) = delete;
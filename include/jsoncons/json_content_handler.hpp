@@ -21,6 +21,16 @@ struct null_type
 {
 };
 
+// borrowed_string_arg_t
+
+// Selects basic_json string storage that refers to, rather than copies, the characters
+struct borrowed_string_arg_t
+{
+    explicit borrowed_string_arg_t() = default; 
+};
+
+constexpr borrowed_string_arg_t borrowed_string_arg{};
+
 enum class semantic_tag : uint8_t 
 {
     none = 0,
@@ -73,7 +73,7 @@ public:
                            typename std::enable_if<!std::is_constructible<basic_string_view<CharT>,Source>::value>::type* = 0)
        : event_handler_(filter),
          parser_(options,err_handler),
-         source_(source),
+         source_(std::forward<Source>(source)),
          buffer_length_(default_max_buffer_length),
          eof_(false),
          begin_(true)
@@ -170,7 +170,7 @@ public:
                            typename std::enable_if<!std::is_constructible<basic_string_view<CharT>,Source>::value>::type* = 0)
        : event_handler_(filter),
          parser_(options,err_handler),
-         source_(source),
+         source_(std::forward<Source>(source)),
          eof_(false),
          buffer_length_(default_max_buffer_length),
          begin_(true)
@@ -273,29 +273,27 @@ public:
 
     void read_buffer(std::error_code& ec)
     {
-        buffer_.clear();
-        buffer_.resize(buffer_length_);
-        size_t count = source_.read(buffer_.data(), buffer_length_);
-        buffer_.resize(static_cast<size_t>(count));
-        if (buffer_.size() == 0)
+        const CharT* data;
+        size_t count = read_source(data, is_contiguous_source<Src>());
+        if (count == 0)
         {
             eof_ = true;
         }
         else if (begin_)
         {
-            auto result = unicons::skip_bom(buffer_.begin(), buffer_.end());
+            auto result = unicons::skip_bom(data, data+count);
             if (result.ec != unicons::encoding_errc())
             {
                 ec = result.ec;
                 return;
             }
-            size_t offset = result.it - buffer_.begin();
-            parser_.update(buffer_.data()+offset,buffer_.size()-offset);
+            size_t offset = result.it - data;
+            parser_.update(data+offset,count-offset);
             begin_ = false;
         }
         else
         {
-            parser_.update(buffer_.data(),buffer_.size());
+            parser_.update(data,count);
         }
     }
 
@@ -393,6 +391,20 @@ public:
         return parser_.column();
     }
 private:
+    size_t read_source(const CharT*& data, std::true_type)
+    {
+        return source_.read_view(data, buffer_length_);
+    }
+
+    size_t read_source(const CharT*& data, std::false_type)
+    {
+        buffer_.clear();
+        buffer_.resize(buffer_length_);
+        size_t count = source_.read(buffer_.data(), buffer_length_);
+        buffer_.resize(static_cast<size_t>(count));
+        data = buffer_.data();
+        return count;
+    }
 };
 
 typedef basic_json_cursor<char> json_cursor;
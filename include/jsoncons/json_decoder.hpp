@@ -15,6 +15,7 @@
 #include <utility> // std::move
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_content_handler.hpp>
+#include <jsoncons/string_pool.hpp>
 
 namespace jsoncons {
 
@@ -34,6 +35,7 @@ public:
     typedef typename array::allocator_type json_array_allocator;
     typedef typename object::allocator_type json_object_allocator;
     typedef typename std::allocator_traits<result_allocator_type>:: template rebind_alloc<uint8_t> json_byte_allocator_type;
+    typedef basic_string_pool<char_type> string_pool_type;
 private:
     struct stack_item
     {
@@ -84,6 +86,10 @@ private:
     std::vector<stack_item,stack_item_allocator_type> item_stack_;
     std::vector<structure_info,structure_info_allocator_type> structure_stack_;
     bool is_valid_;
+    const char_type* borrow_first_;
+    const char_type* borrow_last_;
+    string_pool_type* pool_;
+    size_t intern_max_length_;
 
 public:
     json_decoder(const result_allocator_type& rallocator = result_allocator_type(), 
@@ -98,8 +104,11 @@ public:
           name_(string_allocator_),
           item_stack_(stack_item_allocator_),
           structure_stack_(size_t_allocator_),
-          is_valid_(false) 
-
+          is_valid_(false),
+          borrow_first_(nullptr),
+          borrow_last_(nullptr),
+          pool_(nullptr),
+          intern_max_length_(0)
     {
         item_stack_.reserve(1000);
         structure_stack_.reserve(100);
@@ -117,6 +126,22 @@ public:
         return std::move(result_);
     }
 
+    // String values that lie within [data, data+length) are stored as borrowed strings
+    void borrow_strings(const char_type* data, size_t length)
+    {
+        borrow_first_ = data;
+        borrow_last_ = data + length;
+    }
+
+    // String values of up to max_length characters are copied once into pool and stored 
+    // as borrowed strings that refer to the pooled copy. Object names of up to max_length 
+    // characters go through the pool too, and a member's key is copied from the pooled name.
+    void intern_strings(string_pool_type& pool, size_t max_length = 64)
+    {
+        pool_ = &pool;
+        intern_max_length_ = max_length;
+    }
+
 #if !defined(JSONCONS_NO_DEPRECATED)
     JSONCONS_DEPRECATED_MSG("Instead, use get_result()")
     Json& root()
@@ -152,11 +177,15 @@ private:
         const size_t count = item_stack_.size() - (structure_index + 1);
         auto first = item_stack_.begin() + (structure_index+1);
         auto last = first + count;
-        item_stack_[structure_index].value_.object_value().insert(
-            std::make_move_iterator(first),
-            std::make_move_iterator(last),
-            [](stack_item&& val){return key_value_type(std::move(val.name_), std::move(val.value_));}
-        );
+        // An object without members stays an empty object value, which does not allocate
+        if (count > 0)
+        {
+            item_stack_[structure_index].value_.object_value().insert(
+                std::make_move_iterator(first),
+                std::make_move_iterator(last),
+                [](stack_item&& val){return key_value_type(std::move(val.name_), std::move(val.value_));}
+            );
+        }
         item_stack_.erase(item_stack_.begin()+structure_index+1, item_stack_.end());
         structure_stack_.pop_back();
         if (structure_stack_.back().type_ == structure_type::root_t)
@@ -211,12 +240,28 @@ private:
 
     bool do_name(const string_view_type& name, const ser_context&) override
     {
-        name_ = key_type(name.data(),name.length(),string_allocator_);
+        if (pool_ != nullptr && name.length() <= intern_max_length_)
+        {
+            const string_view_type pooled = pool_->intern(name);
+            name_ = key_type(pooled.data(),pooled.length(),string_allocator_);
+        }
+        else
+        {
+            name_ = key_type(name.data(),name.length(),string_allocator_);
+        }
         return true;
     }
 
-    bool do_string_value(const string_view_type& sv, semantic_tag tag, const ser_context&) override
+    bool do_string_value(const string_view_type& sv, semantic_tag tag, const ser_context& context) override
     {
+        if (borrow_first_ != nullptr && sv.data() >= borrow_first_ && sv.data() + sv.length() <= borrow_last_)
+        {
+            return borrowed_string_value(sv, tag, context);
+        }
+        if (pool_ != nullptr && sv.length() > Json::variant::short_string_data::max_length && sv.length() <= intern_max_length_)
+        {
+            return borrowed_string_value(pool_->intern(sv), tag, context);
+        }
         switch (structure_stack_.back().type_)
         {
             case structure_type::object_t:
@@ -231,6 +276,22 @@ private:
         return true;
     }
 
+    bool borrowed_string_value(const string_view_type& sv, semantic_tag tag, const ser_context&)
+    {
+        switch (structure_stack_.back().type_)
+        {
+            case structure_type::object_t:
+            case structure_type::array_t:
+                item_stack_.emplace_back(std::forward<key_type>(name_), borrowed_string_arg, sv, tag);
+                break;
+            case structure_type::root_t:
+                result_ = Json(borrowed_string_arg, sv, tag);
+                is_valid_ = true;
+                return false;
+        }
+        return true;
+    }
+
     bool do_byte_string_value(const byte_string_view& b, semantic_tag tag, const ser_context&) override
     {
         switch (structure_stack_.back().type_)
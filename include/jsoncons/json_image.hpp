@@ -0,0 +1,766 @@
+// Copyright 2019 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_IMAGE_HPP
+#define JSONCONS_JSON_IMAGE_HPP
+
+#include <algorithm> // std::sort, std::lower_bound
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <ostream>
+#include <string>
+#include <type_traits> // std::enable_if
+#include <vector>
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/byte_string.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_content_handler.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/detail/json_view_base.hpp>
+
+namespace jsoncons {
+
+// Image layout, all integers in native byte order, all offsets from the start of the image:
+//
+// header   magic (8 bytes), version (4), sizeof(CharT) (2), byte order mark 0x0102 (2), root slot (16)
+// slot     type (1), semantic_tag (1), unused (6), payload (8)
+// string   length (8), characters, a null character, padding to a multiple of 8
+// array    count (8), count slots
+// object   count (8), count entries of key string offset (8) and slot (16), sorted by key
+//
+// The payload of a slot holds a number, or the offset of a string, byte string, array or object.
+
+namespace detail {
+
+enum class image_type : uint8_t
+{
+    null_value = 0,
+    false_value = 1,
+    true_value = 2,
+    int64_value = 3,
+    uint64_value = 4,
+    double_value = 5,
+    string_value = 6,
+    byte_string_value = 7,
+    array_value = 8,
+    object_value = 9
+};
+
+const uint64_t json_image_magic = 0x474d494e4f534a01; // "\x01JSONIMG" read as little endian
+const uint32_t json_image_version = 2;
+const uint16_t json_image_byte_order_mark = 0x0102;
+const size_t json_image_header_size = 32;
+const size_t json_image_slot_size = 16;
+const size_t json_image_entry_size = 24;
+
+inline
+uint64_t load_image_word(const uint8_t* p)
+{
+    uint64_t val;
+    std::memcpy(&val, p, sizeof(uint64_t));
+    return val;
+}
+
+// basic_json_image_writer
+
+template <class Json>
+class basic_json_image_writer
+{
+    typedef typename Json::char_type char_type;
+    typedef typename Json::string_view_type string_view_type;
+    typedef typename Json::key_value_type key_value_type;
+
+    std::vector<uint8_t>& image_;
+public:
+    basic_json_image_writer(std::vector<uint8_t>& image)
+        : image_(image)
+    {
+    }
+
+    void write(const Json& j)
+    {
+        image_.clear();
+        image_.resize(json_image_header_size);
+        store_word(0, json_image_magic);
+        const uint32_t version = json_image_version;
+        const uint16_t char_size = sizeof(char_type);
+        const uint16_t byte_order = json_image_byte_order_mark;
+        std::memcpy(image_.data() + 8, &version, sizeof(uint32_t));
+        std::memcpy(image_.data() + 12, &char_size, sizeof(uint16_t));
+        std::memcpy(image_.data() + 14, &byte_order, sizeof(uint16_t));
+        write_slot(16, j);
+    }
+
+private:
+    void store_word(size_t offset, uint64_t val)
+    {
+        std::memcpy(image_.data() + offset, &val, sizeof(uint64_t));
+    }
+
+    // Appends count bytes at a multiple of 8, returns their offset
+    size_t allocate(size_t count)
+    {
+        const size_t offset = (image_.size() + 7) & ~size_t(7);
+        image_.resize(offset + ((count + 7) & ~size_t(7)));
+        return offset;
+    }
+
+    size_t write_string(const char_type* data, size_t length)
+    {
+        const size_t offset = allocate(8 + (length + 1)*sizeof(char_type));
+        store_word(offset, length);
+        std::memcpy(image_.data() + offset + 8, data, length*sizeof(char_type));
+        return offset;
+    }
+
+    size_t write_bytes(const byte_string_view& b)
+    {
+        const size_t offset = allocate(8 + b.length());
+        store_word(offset, b.length());
+        std::memcpy(image_.data() + offset + 8, b.data(), b.length());
+        return offset;
+    }
+
+    size_t write_array(const Json& j)
+    {
+        const size_t count = j.size();
+        const size_t offset = allocate(8 + count*json_image_slot_size);
+        store_word(offset, count);
+        size_t slot = offset + 8;
+        for (const auto& item : j.array_range())
+        {
+            write_slot(slot, item);
+            slot += json_image_slot_size;
+        }
+        return offset;
+    }
+
+    size_t write_object(const Json& j)
+    {
+        std::vector<const key_value_type*> members;
+        members.reserve(j.size());
+        for (const auto& member : j.object_range())
+        {
+            members.push_back(&member);
+        }
+        std::sort(members.begin(), members.end(),
+                  [](const key_value_type* a, const key_value_type* b) -> bool
+                  {
+                      return string_view_type(a->key().data(), a->key().length()).compare(string_view_type(b->key().data(), b->key().length())) < 0;
+                  });
+
+        const size_t count = members.size();
+        const size_t offset = allocate(8 + count*json_image_entry_size);
+        store_word(offset, count);
+        size_t entry = offset + 8;
+        for (const key_value_type* member : members)
+        {
+            const size_t key = write_string(member->key().data(), member->key().length());
+            store_word(entry, key);
+            write_slot(entry + 8, member->value());
+            entry += json_image_entry_size;
+        }
+        return offset;
+    }
+
+    // Children are written before the slot is stored, since writing them may reallocate the image
+    void write_slot(size_t slot, const Json& j)
+    {
+        image_type type;
+        uint64_t payload = 0;
+        switch (j.type())
+        {
+            case storage_type::null_value:
+                type = image_type::null_value;
+                break;
+            case storage_type::bool_value:
+                type = j.as_bool() ? image_type::true_value : image_type::false_value;
+                break;
+            case storage_type::int64_value:
+                type = image_type::int64_value;
+                payload = static_cast<uint64_t>(j.template as_integer<int64_t>());
+                break;
+            case storage_type::uint64_value:
+                type = image_type::uint64_value;
+                payload = j.template as_integer<uint64_t>();
+                break;
+            case storage_type::double_value:
+            {
+                type = image_type::double_value;
+                double val = j.as_double();
+                std::memcpy(&payload, &val, sizeof(double));
+                break;
+            }
+            case storage_type::byte_string_value:
+                type = image_type::byte_string_value;
+                payload = write_bytes(j.as_byte_string_view());
+                break;
+            case storage_type::empty_array_value:
+            case storage_type::array_value:
+                type = image_type::array_value;
+                payload = write_array(j);
+                break;
+            case storage_type::empty_object_value:
+            case storage_type::object_value:
+                type = image_type::object_value;
+                payload = write_object(j);
+                break;
+            default:
+            {
+                type = image_type::string_value;
+                auto sv = j.as_string_view();
+                payload = write_string(sv.data(), sv.length());
+                break;
+            }
+        }
+        image_[slot] = static_cast<uint8_t>(type);
+        image_[slot + 1] = static_cast<uint8_t>(j.tag());
+        store_word(slot + 8, payload);
+    }
+};
+
+}
+
+template <class CharT>
+class basic_json_image_member;
+
+// basic_json_image_value
+
+// A read-only view of a value in a json image. Arrays are indexed in constant
+// time and object members are found by binary search.
+
+template <class CharT>
+class basic_json_image_value
+    : public jsoncons::detail::json_view_base<basic_json_image_value<CharT>,CharT,basic_json_image_member<CharT>>
+{
+    typedef jsoncons::detail::json_view_base<basic_json_image_value<CharT>,CharT,basic_json_image_member<CharT>> base_type;
+public:
+    typedef CharT char_type;
+    typedef std::basic_string<CharT> string_type;
+    typedef basic_string_view<CharT> string_view_type;
+    typedef basic_json_image_member<CharT> member_type;
+    typedef typename base_type::array_iterator array_iterator;
+    typedef typename base_type::object_iterator object_iterator;
+
+    using base_type::at;
+private:
+    template <class C> friend class basic_json_image;
+    friend class jsoncons::detail::json_view_base<basic_json_image_value<CharT>,CharT,basic_json_image_member<CharT>>;
+
+    const uint8_t* data_;
+    size_t size_;
+    size_t slot_;
+
+    basic_json_image_value(const uint8_t* data, size_t size, size_t slot)
+        : data_(data), size_(size), slot_(slot)
+    {
+        check(slot_, jsoncons::detail::json_image_slot_size);
+    }
+public:
+    semantic_tag tag() const
+    {
+        return static_cast<semantic_tag>(data_[slot_ + 1]);
+    }
+
+    bool is_null() const
+    {
+        return type() == jsoncons::detail::image_type::null_value;
+    }
+
+    bool is_bool() const
+    {
+        return type() == jsoncons::detail::image_type::true_value || type() == jsoncons::detail::image_type::false_value;
+    }
+
+    bool is_int64() const
+    {
+        return type() == jsoncons::detail::image_type::int64_value;
+    }
+
+    bool is_uint64() const
+    {
+        return type() == jsoncons::detail::image_type::uint64_value;
+    }
+
+    bool is_double() const
+    {
+        return type() == jsoncons::detail::image_type::double_value;
+    }
+
+    bool is_number() const
+    {
+        return is_int64() || is_uint64() || is_double();
+    }
+
+    bool is_string() const
+    {
+        return type() == jsoncons::detail::image_type::string_value;
+    }
+
+    bool is_byte_string() const
+    {
+        return type() == jsoncons::detail::image_type::byte_string_value;
+    }
+
+    bool is_array() const
+    {
+        return type() == jsoncons::detail::image_type::array_value;
+    }
+
+    bool is_object() const
+    {
+        return type() == jsoncons::detail::image_type::object_value;
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    // The number of elements, members, or characters or bytes of a string
+    size_t size() const
+    {
+        switch (type())
+        {
+            case jsoncons::detail::image_type::string_value:
+            case jsoncons::detail::image_type::byte_string_value:
+            case jsoncons::detail::image_type::array_value:
+            case jsoncons::detail::image_type::object_value:
+                return static_cast<size_t>(load(payload()));
+            default:
+                return 0;
+        }
+    }
+
+    basic_json_image_value at(size_t i) const
+    {
+        if (!is_array())
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Index on non-array value not supported"));
+        }
+        const size_t count = size();
+        if (i >= count)
+        {
+            JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+        }
+        const size_t first = elements_offset(i + 1, jsoncons::detail::json_image_slot_size);
+        return basic_json_image_value(data_, size_, first + i*jsoncons::detail::json_image_slot_size);
+    }
+
+    bool as_bool() const
+    {
+        switch (type())
+        {
+            case jsoncons::detail::image_type::true_value:
+                return true;
+            case jsoncons::detail::image_type::false_value:
+                return false;
+            default:
+                return to_json().as_bool();
+        }
+    }
+
+    double as_double() const
+    {
+        switch (type())
+        {
+            case jsoncons::detail::image_type::int64_value:
+                return static_cast<double>(static_cast<int64_t>(payload()));
+            case jsoncons::detail::image_type::uint64_value:
+                return static_cast<double>(payload());
+            case jsoncons::detail::image_type::double_value:
+                return double_payload();
+            default:
+                return to_json().as_double();
+        }
+    }
+
+    template <class T>
+    T as_integer() const
+    {
+        switch (type())
+        {
+            case jsoncons::detail::image_type::int64_value:
+                return static_cast<T>(static_cast<int64_t>(payload()));
+            case jsoncons::detail::image_type::uint64_value:
+                return static_cast<T>(payload());
+            case jsoncons::detail::image_type::double_value:
+                return static_cast<T>(double_payload());
+            default:
+                return to_json().template as_integer<T>();
+        }
+    }
+
+    string_view_type as_string_view() const
+    {
+        if (!is_string())
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Not a string"));
+        }
+        return string_at(static_cast<size_t>(payload()));
+    }
+
+    byte_string_view as_byte_string_view() const
+    {
+        if (!is_byte_string())
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Not a byte string"));
+        }
+        const size_t offset = static_cast<size_t>(payload());
+        const size_t length = static_cast<size_t>(load(offset));
+        check(offset + 8, length);
+        return byte_string_view(data_ + offset + 8, length);
+    }
+
+    string_type as_string() const
+    {
+        if (is_string())
+        {
+            string_view_type s = as_string_view();
+            return string_type(s.data(), s.length());
+        }
+        return to_json().as_string();
+    }
+
+    void dump(basic_json_content_handler<CharT>& handler) const
+    {
+        dump_noflush(handler);
+        handler.flush();
+    }
+
+    template <class Json = basic_json<CharT>>
+    Json to_json() const
+    {
+        json_decoder<Json> decoder;
+        dump_noflush(decoder);
+        return decoder.get_result();
+    }
+
+private:
+    void check(size_t offset, size_t length) const
+    {
+        if (offset > size_ || length > size_ - offset)
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Offset outside json image"));
+        }
+    }
+
+    // Returns the offset of the first of count elements of element_size bytes that follow
+    // the count word at payload(), checking that they lie within the image. The bound is
+    // computed by division, so a corrupt count cannot wrap it. Containers are written after
+    // the slot that refers to them, so an offset that does not move forward is rejected, which
+    // bounds the depth of a descent by the size of the image even if the image is corrupt.
+    size_t elements_offset(size_t count, size_t element_size) const
+    {
+        const uint64_t offset = payload();
+        if (offset <= slot_)
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Invalid json image"));
+        }
+        if (offset > size_ || size_ - offset < 8 || count > (size_ - offset - 8)/element_size)
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Offset outside json image"));
+        }
+        return static_cast<size_t>(offset) + 8;
+    }
+
+    // Elements are identified by the offset of their slot, members by the offset of their entry
+
+    void element_positions(size_t& first, size_t& last) const
+    {
+        const size_t count = size();
+        first = elements_offset(count, jsoncons::detail::json_image_slot_size);
+        last = first + count*jsoncons::detail::json_image_slot_size;
+    }
+
+    void member_positions(size_t& first, size_t& last) const
+    {
+        const size_t count = size();
+        first = elements_offset(count, jsoncons::detail::json_image_entry_size);
+        last = first + count*jsoncons::detail::json_image_entry_size;
+    }
+
+    basic_json_image_value element_at(size_t slot) const
+    {
+        return basic_json_image_value(data_, size_, slot);
+    }
+
+    size_t next_element(size_t slot) const
+    {
+        return slot + jsoncons::detail::json_image_slot_size;
+    }
+
+    member_type member_at(size_t entry) const
+    {
+        basic_json_image_value value(data_, size_, entry + 8);
+        return member_type(key_at(entry), value);
+    }
+
+    size_t next_member(size_t entry) const
+    {
+        return entry + jsoncons::detail::json_image_entry_size;
+    }
+
+    uint64_t load(size_t offset) const
+    {
+        check(offset, 8);
+        return jsoncons::detail::load_image_word(data_ + offset);
+    }
+
+    jsoncons::detail::image_type type() const
+    {
+        return static_cast<jsoncons::detail::image_type>(data_[slot_]);
+    }
+
+    uint64_t payload() const
+    {
+        return jsoncons::detail::load_image_word(data_ + slot_ + 8);
+    }
+
+    double double_payload() const
+    {
+        uint64_t bits = payload();
+        double val;
+        std::memcpy(&val, &bits, sizeof(double));
+        return val;
+    }
+
+    string_view_type string_at(size_t offset) const
+    {
+        const size_t length = static_cast<size_t>(load(offset));
+        if (length > (size_ - offset - 8)/sizeof(CharT))
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Offset outside json image"));
+        }
+        return string_view_type(reinterpret_cast<const CharT*>(data_ + offset + 8), length);
+    }
+
+    string_view_type key_at(size_t entry) const
+    {
+        return string_at(static_cast<size_t>(load(entry)));
+    }
+
+    bool find_member(const string_view_type& name, size_t& slot) const
+    {
+        size_t count = size();
+        size_t first = elements_offset(count, jsoncons::detail::json_image_entry_size);
+        const size_t end = first + count*jsoncons::detail::json_image_entry_size;
+        while (count > 0)
+        {
+            const size_t half = count / 2;
+            const size_t entry = first + half*jsoncons::detail::json_image_entry_size;
+            if (key_at(entry).compare(name) < 0)
+            {
+                first = entry + jsoncons::detail::json_image_entry_size;
+                count -= half + 1;
+            }
+            else
+            {
+                count = half;
+            }
+        }
+        if (first != end && key_at(first) == name)
+        {
+            slot = first + 8;
+            return true;
+        }
+        return false;
+    }
+
+    void dump_noflush(basic_json_content_handler<CharT>& handler) const
+    {
+        const semantic_tag t = tag();
+        switch (type())
+        {
+            case jsoncons::detail::image_type::null_value:
+                handler.null_value(t);
+                break;
+            case jsoncons::detail::image_type::false_value:
+                handler.bool_value(false, t);
+                break;
+            case jsoncons::detail::image_type::true_value:
+                handler.bool_value(true, t);
+                break;
+            case jsoncons::detail::image_type::int64_value:
+                handler.int64_value(static_cast<int64_t>(payload()), t);
+                break;
+            case jsoncons::detail::image_type::uint64_value:
+                handler.uint64_value(payload(), t);
+                break;
+            case jsoncons::detail::image_type::double_value:
+                handler.double_value(double_payload(), t);
+                break;
+            case jsoncons::detail::image_type::string_value:
+                handler.string_value(as_string_view(), t);
+                break;
+            case jsoncons::detail::image_type::byte_string_value:
+                handler.byte_string_value(as_byte_string_view(), t);
+                break;
+            case jsoncons::detail::image_type::array_value:
+                handler.begin_array(size(), t);
+                for (const auto& item : this->array_range())
+                {
+                    item.dump_noflush(handler);
+                }
+                handler.end_array();
+                break;
+            case jsoncons::detail::image_type::object_value:
+                handler.begin_object(size(), t);
+                for (const auto& member : this->object_range())
+                {
+                    handler.name(member.key());
+                    member.value().dump_noflush(handler);
+                }
+                handler.end_object();
+                break;
+            default:
+                JSONCONS_THROW(json_runtime_error<std::runtime_error>("Invalid json image"));
+        }
+    }
+};
+
+// basic_json_image_member
+
+template <class CharT>
+class basic_json_image_member
+{
+public:
+    typedef basic_string_view<CharT> string_view_type;
+private:
+    string_view_type key_;
+    basic_json_image_value<CharT> value_;
+public:
+    basic_json_image_member(const string_view_type& key, const basic_json_image_value<CharT>& value)
+        : key_(key), value_(value)
+    {
+    }
+
+    string_view_type key() const
+    {
+        return key_;
+    }
+
+    const basic_json_image_value<CharT>& value() const
+    {
+        return value_;
+    }
+};
+
+// basic_json_image
+
+// Reads an image written by encode_json_image in place, e.g. from a binary_mmap_source.
+// The image is not copied and must outlive the basic_json_image and its values.
+
+template <class CharT>
+class basic_json_image
+{
+public:
+    typedef CharT char_type;
+    typedef basic_string_view<CharT> string_view_type;
+    typedef basic_json_image_value<CharT> value_type;
+private:
+    const uint8_t* data_;
+    size_t size_;
+public:
+    basic_json_image(const uint8_t* data, size_t size)
+        : data_(data), size_(size)
+    {
+        uint32_t version = 0;
+        uint16_t char_size = 0;
+        uint16_t byte_order = 0;
+        if (size_ >= jsoncons::detail::json_image_header_size)
+        {
+            std::memcpy(&version, data_ + 8, sizeof(uint32_t));
+            std::memcpy(&char_size, data_ + 12, sizeof(uint16_t));
+            std::memcpy(&byte_order, data_ + 14, sizeof(uint16_t));
+        }
+        if (size_ < jsoncons::detail::json_image_header_size)
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Invalid json image"));
+        }
+        if (byte_order == 0x0201)
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Json image has a different byte order"));
+        }
+        if (jsoncons::detail::load_image_word(data_) != jsoncons::detail::json_image_magic ||
+            byte_order != jsoncons::detail::json_image_byte_order_mark ||
+            version != jsoncons::detail::json_image_version || char_size != sizeof(CharT))
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Invalid json image"));
+        }
+    }
+
+    explicit basic_json_image(const std::vector<uint8_t>& image)
+        : basic_json_image(image.data(), image.size())
+    {
+    }
+
+    const uint8_t* data() const
+    {
+        return data_;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    value_type root() const
+    {
+        return value_type(data_, size_, 16);
+    }
+
+    value_type at(const string_view_type& name) const
+    {
+        return root().at(name);
+    }
+
+    value_type operator[](const string_view_type& name) const
+    {
+        return root().at(name);
+    }
+
+    value_type at(size_t i) const
+    {
+        return root().at(i);
+    }
+
+    value_type operator[](size_t i) const
+    {
+        return root().at(i);
+    }
+
+    template <class Json = basic_json<CharT>>
+    Json to_json() const
+    {
+        return root().template to_json<Json>();
+    }
+};
+
+typedef basic_json_image<char> json_image;
+typedef basic_json_image<wchar_t> wjson_image;
+
+// encode_json_image
+
+template <class Json>
+void encode_json_image(const Json& j, std::vector<uint8_t>& image)
+{
+    jsoncons::detail::basic_json_image_writer<Json> writer(image);
+    writer.write(j);
+}
+
+template <class Json>
+void encode_json_image(const Json& j, std::ostream& os)
+{
+    std::vector<uint8_t> image;
+    encode_json_image(j, image);
+    os.write(reinterpret_cast<const char*>(image.data()), image.size());
+}
+
+}
+
+#endif
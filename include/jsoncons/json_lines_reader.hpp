@@ -0,0 +1,595 @@
+// Copyright 2019 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_LINES_READER_HPP
+#define JSONCONS_JSON_LINES_READER_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception> // std::exception_ptr
+#include <functional>
+#include <map>
+#include <memory> // std::unique_ptr
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility> // std::move
+#include <vector>
+#include <jsoncons/source.hpp>
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_content_handler.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/json_tape.hpp>
+#include <jsoncons/unicode_traits.hpp>
+
+namespace jsoncons {
+
+// json_lines_options
+
+class json_lines_options
+{
+    size_t num_threads_;
+    size_t batch_size_;
+    size_t max_pending_batches_;
+    bool ordered_;
+public:
+    json_lines_options()
+        : num_threads_(0),
+          batch_size_(1024),
+          max_pending_batches_(0),
+          ordered_(true)
+    {
+    }
+
+    // Number of worker threads, 0 for the number of hardware threads
+    size_t num_threads() const
+    {
+        return num_threads_;
+    }
+
+    json_lines_options& num_threads(size_t value)
+    {
+        num_threads_ = value;
+        return *this;
+    }
+
+    // Number of records parsed by a worker at a time
+    size_t batch_size() const
+    {
+        return batch_size_;
+    }
+
+    json_lines_options& batch_size(size_t value)
+    {
+        batch_size_ = value;
+        return *this;
+    }
+
+    // Maximum number of batches read but not yet delivered, 0 for twice the number of threads
+    size_t max_pending_batches() const
+    {
+        return max_pending_batches_;
+    }
+
+    json_lines_options& max_pending_batches(size_t value)
+    {
+        max_pending_batches_ = value;
+        return *this;
+    }
+
+    // If false, batches are delivered in the order they finish rather than in input order
+    bool ordered() const
+    {
+        return ordered_;
+    }
+
+    json_lines_options& ordered(bool value)
+    {
+        ordered_ = value;
+        return *this;
+    }
+};
+
+// basic_json_lines_reader
+
+template <class Json,class Src=jsoncons::stream_source<typename Json::char_type>>
+class basic_json_lines_reader
+{
+public:
+    typedef typename Json::char_type char_type;
+    typedef Src source_type;
+private:
+    static const size_t default_max_buffer_length = 16384;
+
+    struct record_span
+    {
+        size_t offset;
+        size_t length;
+        size_t line;
+    };
+
+    struct record_result
+    {
+        Json value;
+        std::error_code ec;
+        size_t line;
+        size_t column;
+    };
+
+    struct batch
+    {
+        size_t sequence;
+        std::basic_string<char_type> text;
+        std::vector<record_span> records;
+        std::vector<record_result> results;
+        // When replaying to a handler, the events of results[i] instead of a value
+        std::vector<basic_json_tape<char_type>> tapes;
+        // Thrown while parsing the record after the last of results
+        std::exception_ptr exception;
+    };
+
+    typedef std::unique_ptr<batch> batch_ptr;
+
+    source_type source_;
+    json_lines_options lines_options_;
+    jsoncons::detail::decode_options_copy<char_type> options_;
+    std::vector<char_type> buffer_;
+    size_t buffer_pos_;
+    size_t line_;
+    bool begin_;
+    bool eof_;
+
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    std::deque<batch_ptr> work_queue_;
+    std::map<size_t,batch_ptr> done_;
+    bool stop_;
+    bool replay_;
+    // Thrown by a worker outside of a batch
+    std::exception_ptr exception_;
+
+    // Noncopyable and nonmoveable
+    basic_json_lines_reader(const basic_json_lines_reader&) = delete;
+    basic_json_lines_reader& operator=(const basic_json_lines_reader&) = delete;
+
+public:
+    template <class Source>
+    basic_json_lines_reader(Source&& source,
+                            const json_lines_options& lines_options = json_lines_options(),
+                            const basic_json_decode_options<char_type>& options = basic_json_options<char_type>::get_default_options())
+       : source_(std::forward<Source>(source)),
+         lines_options_(lines_options),
+         options_(options),
+         buffer_pos_(0),
+         line_(1),
+         begin_(true),
+         eof_(false),
+         stop_(false),
+         replay_(false)
+    {
+    }
+
+    // Passes each record to on_value, and each record that fails to parse to on_error.
+    // If on_error is empty, the first such error is thrown after the records before it are delivered.
+    void read(std::function<void(Json&&)> on_value,
+              std::function<void(const ser_error&)> on_error = std::function<void(const ser_error&)>())
+    {
+        read_batches(false, [&](batch& b){deliver(b, on_value, on_error);});
+    }
+
+    // Replays each record to handler. Workers record the events of each record on a tape,
+    // so no values are built.
+    void read(basic_json_content_handler<char_type>& handler,
+              std::function<void(const ser_error&)> on_error = std::function<void(const ser_error&)>())
+    {
+        read_batches(true, [&](batch& b){replay(b, handler, on_error);});
+    }
+
+private:
+
+    template <class Deliver>
+    void read_batches(bool replay, Deliver deliver)
+    {
+        replay_ = replay;
+        exception_ = nullptr;
+
+        size_t num_threads = lines_options_.num_threads();
+        if (num_threads == 0)
+        {
+            num_threads = std::thread::hardware_concurrency();
+            if (num_threads == 0)
+            {
+                num_threads = 1;
+            }
+        }
+        size_t max_pending = lines_options_.max_pending_batches();
+        if (max_pending == 0)
+        {
+            max_pending = 2*num_threads;
+        }
+        const bool ordered = lines_options_.ordered();
+
+        worker_pool pool(*this, num_threads);
+
+        size_t next_sequence = 0;
+        size_t next_delivery = 0;
+        size_t pending = 0;
+        bool input_done = false;
+
+        while (true)
+        {
+            batch_ptr ready;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                done_cv_.wait(lock, [&]() -> bool
+                {
+                    return is_deliverable(ordered, next_delivery) || (!input_done && pending < max_pending) || pending == 0 || exception_;
+                });
+                if (exception_)
+                {
+                    std::exception_ptr e = exception_;
+                    exception_ = nullptr;
+                    lock.unlock();
+                    std::rethrow_exception(e);
+                }
+                if (is_deliverable(ordered, next_delivery))
+                {
+                    ready = std::move(done_.begin()->second);
+                    done_.erase(done_.begin());
+                }
+                else if (input_done)
+                {
+                    break;
+                }
+            }
+            if (ready)
+            {
+                --pending;
+                ++next_delivery;
+                deliver(*ready);
+                continue;
+            }
+
+            batch_ptr b = read_batch(next_sequence);
+            if (b)
+            {
+                ++next_sequence;
+                ++pending;
+                std::lock_guard<std::mutex> lock(mutex_);
+                work_queue_.push_back(std::move(b));
+                work_cv_.notify_one();
+            }
+            else
+            {
+                input_done = true;
+            }
+        }
+    }
+
+    class worker_pool
+    {
+        basic_json_lines_reader& reader_;
+        std::vector<std::thread> threads_;
+    public:
+        worker_pool(basic_json_lines_reader& reader, size_t num_threads)
+            : reader_(reader)
+        {
+            reader_.stop_ = false;
+            threads_.reserve(num_threads);
+            for (size_t i = 0; i < num_threads; ++i)
+            {
+                threads_.emplace_back([this](){reader_.work();});
+            }
+        }
+
+        ~worker_pool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(reader_.mutex_);
+                reader_.stop_ = true;
+                reader_.work_queue_.clear();
+                reader_.done_.clear();
+            }
+            reader_.work_cv_.notify_all();
+            for (auto& t : threads_)
+            {
+                t.join();
+            }
+        }
+    };
+
+    bool is_deliverable(bool ordered, size_t next_delivery) const
+    {
+        return !done_.empty() && (!ordered || done_.begin()->first == next_delivery);
+    }
+
+    void deliver(batch& b,
+                 const std::function<void(Json&&)>& on_value,
+                 const std::function<void(const ser_error&)>& on_error)
+    {
+        for (auto& result : b.results)
+        {
+            if (result.ec)
+            {
+                if (on_error)
+                {
+                    on_error(ser_error(result.ec, result.line, result.column));
+                }
+                else
+                {
+                    JSONCONS_THROW(ser_error(result.ec, result.line, result.column));
+                }
+            }
+            else
+            {
+                on_value(std::move(result.value));
+            }
+        }
+        if (b.exception)
+        {
+            std::rethrow_exception(b.exception);
+        }
+    }
+
+    void replay(batch& b,
+                basic_json_content_handler<char_type>& handler,
+                const std::function<void(const ser_error&)>& on_error)
+    {
+        for (size_t i = 0; i < b.results.size(); ++i)
+        {
+            const record_result& result = b.results[i];
+            if (result.ec)
+            {
+                if (on_error)
+                {
+                    on_error(ser_error(result.ec, result.line, result.column));
+                }
+                else
+                {
+                    JSONCONS_THROW(ser_error(result.ec, result.line, result.column));
+                }
+            }
+            else
+            {
+                b.tapes[i].dump(handler);
+            }
+        }
+        if (b.exception)
+        {
+            std::rethrow_exception(b.exception);
+        }
+    }
+
+    // An exception thrown on a worker is rethrown by read on the calling thread
+    void work()
+    {
+        JSONCONS_TRY
+        {
+            work_batches();
+        }
+        JSONCONS_CATCH(...)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                exception_ = std::current_exception();
+            }
+            done_cv_.notify_all();
+        }
+    }
+
+    void work_batches()
+    {
+        basic_json_parser<char_type> parser(options_);
+        std::unique_ptr<json_decoder<Json>> decoder;
+        std::unique_ptr<basic_json_tape_builder<char_type>> builder;
+        basic_json_content_handler<char_type>* handler = nullptr;
+
+        while (true)
+        {
+            batch_ptr b;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                work_cv_.wait(lock, [this]() -> bool {return stop_ || !work_queue_.empty();});
+                if (stop_)
+                {
+                    return;
+                }
+                b = std::move(work_queue_.front());
+                work_queue_.pop_front();
+            }
+
+            JSONCONS_TRY
+            {
+                parse_batch(*b, parser, decoder, builder, handler);
+            }
+            JSONCONS_CATCH(...)
+            {
+                b->exception = std::current_exception();
+                handler = nullptr;
+            }
+            b->text.clear();
+            b->text.shrink_to_fit();
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (stop_)
+                {
+                    return;
+                }
+                size_t sequence = b->sequence;
+                done_.emplace(sequence, std::move(b));
+            }
+            done_cv_.notify_one();
+        }
+    }
+
+    // handler is null when the decoder or builder has to be replaced
+    void parse_batch(batch& b,
+                     basic_json_parser<char_type>& parser,
+                     std::unique_ptr<json_decoder<Json>>& decoder,
+                     std::unique_ptr<basic_json_tape_builder<char_type>>& builder,
+                     basic_json_content_handler<char_type>*& handler)
+    {
+        b.results.reserve(b.records.size());
+        if (replay_)
+        {
+            b.tapes.reserve(b.records.size());
+        }
+        for (const auto& record : b.records)
+        {
+            if (!handler)
+            {
+                if (replay_)
+                {
+                    builder.reset(new basic_json_tape_builder<char_type>());
+                    handler = builder.get();
+                }
+                else
+                {
+                    decoder.reset(new json_decoder<Json>());
+                    handler = decoder.get();
+                }
+            }
+            std::error_code ec;
+            parser.reset();
+            parser.set_position(record.line, 1);
+            parser.update(b.text.data() + record.offset, record.length);
+            parser.parse_some(*handler, ec);
+            if (!ec)
+            {
+                parser.finish_parse(*handler, ec);
+            }
+            if (!ec)
+            {
+                parser.check_done(ec);
+            }
+            const bool valid = replay_ ? builder->is_valid() : decoder->is_valid();
+            if (!ec && valid)
+            {
+                if (replay_)
+                {
+                    b.tapes.push_back(builder->get_result());
+                    b.results.push_back(record_result{Json(), ec, record.line, parser.column()});
+                }
+                else
+                {
+                    b.results.push_back(record_result{decoder->get_result(), ec, record.line, parser.column()});
+                }
+            }
+            else
+            {
+                if (!ec)
+                {
+                    ec = json_errc::unexpected_eof;
+                }
+                handler = nullptr;
+                b.results.push_back(record_result{Json(), ec, parser.line(), parser.column()});
+                if (replay_)
+                {
+                    b.tapes.emplace_back();
+                }
+            }
+        }
+    }
+
+    // Reads up to batch_size non-blank lines, returns nullptr at end of input
+    batch_ptr read_batch(size_t sequence)
+    {
+        batch_ptr b(new batch());
+        b->sequence = sequence;
+
+        const size_t batch_size = lines_options_.batch_size() > 0 ? lines_options_.batch_size() : 1;
+        size_t record_begin = 0;
+        size_t record_line = line_;
+        bool blank = true;
+
+        while (b->records.size() < batch_size)
+        {
+            if (buffer_pos_ == buffer_.size())
+            {
+                if (eof_ || !fill_buffer())
+                {
+                    if (!blank)
+                    {
+                        b->records.push_back(record_span{record_begin, b->text.size() - record_begin, record_line});
+                    }
+                    break;
+                }
+            }
+            const char_type* first = buffer_.data() + buffer_pos_;
+            const char_type* last = buffer_.data() + buffer_.size();
+            const char_type* p = first;
+            while (p != last && *p != '\n')
+            {
+                if (blank && !(*p == ' ' || *p == '\t' || *p == '\r'))
+                {
+                    blank = false;
+                }
+                ++p;
+            }
+            b->text.append(first, p - first);
+            buffer_pos_ += (p - first);
+            if (p != last)
+            {
+                ++buffer_pos_;
+                if (!blank)
+                {
+                    b->records.push_back(record_span{record_begin, b->text.size() - record_begin, record_line});
+                    record_begin = b->text.size();
+                }
+                else
+                {
+                    b->text.resize(record_begin);
+                }
+                ++line_;
+                record_line = line_;
+                blank = true;
+            }
+        }
+        return b->records.empty() ? batch_ptr() : std::move(b);
+    }
+
+    bool fill_buffer()
+    {
+        buffer_.resize(default_max_buffer_length);
+        size_t count = source_.read(buffer_.data(), buffer_.size());
+        buffer_.resize(count);
+        buffer_pos_ = 0;
+        if (source_.is_error())
+        {
+            JSONCONS_THROW(ser_error(json_errc::source_error, line_, 1));
+        }
+        if (count == 0)
+        {
+            eof_ = true;
+            return false;
+        }
+        if (begin_)
+        {
+            begin_ = false;
+            auto result = unicons::skip_bom(buffer_.begin(), buffer_.end());
+            if (result.ec != unicons::encoding_errc())
+            {
+                JSONCONS_THROW(ser_error(result.ec, line_, 1));
+            }
+            buffer_pos_ = result.it - buffer_.begin();
+        }
+        return true;
+    }
+};
+
+typedef basic_json_lines_reader<json> json_lines_reader;
+typedef basic_json_lines_reader<wjson> wjson_lines_reader;
+
+}
+
+#endif
+
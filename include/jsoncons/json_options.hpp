@@ -63,6 +63,12 @@ public:
     virtual string_type neginf_to_str() const = 0;
 
     virtual bool lossless_number() const = 0;
+
+    // Not pure, so that existing implementations of this interface need not override it
+    virtual bool structural_index() const
+    {
+        return false;
+    }
 };
 
 template <class CharT>
@@ -188,6 +194,7 @@ private:
     string_type neginf_to_str_;
 
     bool lossless_number_;
+    bool structural_index_;
 public:
     static const size_t indent_size_default = 4;
     static const size_t line_length_limit_default = 120;
@@ -232,7 +239,8 @@ public:
           is_str_to_nan_(false),
           is_str_to_inf_(false),
           is_str_to_neginf_(false),
-          lossless_number_(false)
+          lossless_number_(false),
+          structural_index_(false)
     {
         new_line_chars_.push_back('\n');
     }
@@ -551,6 +559,17 @@ public:
         return *this;
     }
 
+    bool structural_index() const override
+    {
+        return structural_index_;
+    }
+
+    basic_json_options& structural_index(bool value)
+    {
+        structural_index_ = value;
+        return *this;
+    }
+
     size_t line_length_limit() const override
     {
         return line_length_limit_;
@@ -805,6 +824,50 @@ private:
     }
 };
 
+namespace detail {
+
+// A copy of the caller's decode options, for classes that keep options that may be a temporary
+template <class CharT>
+class decode_options_copy : public basic_json_decode_options<CharT>
+{
+    typedef typename basic_json_decode_options<CharT>::string_type string_type;
+
+    size_t max_nesting_depth_;
+    bool is_str_to_nan_;
+    bool is_str_to_inf_;
+    bool is_str_to_neginf_;
+    string_type nan_to_str_;
+    string_type inf_to_str_;
+    string_type neginf_to_str_;
+    bool lossless_number_;
+    bool structural_index_;
+public:
+    decode_options_copy(const basic_json_decode_options<CharT>& options)
+        : max_nesting_depth_(options.max_nesting_depth()),
+          is_str_to_nan_(options.is_str_to_nan()),
+          is_str_to_inf_(options.is_str_to_inf()),
+          is_str_to_neginf_(options.is_str_to_neginf()),
+          nan_to_str_(options.nan_to_str()),
+          inf_to_str_(options.inf_to_str()),
+          neginf_to_str_(options.neginf_to_str()),
+          lossless_number_(options.lossless_number()),
+          structural_index_(options.structural_index())
+    {
+    }
+
+    size_t max_nesting_depth() const override {return max_nesting_depth_;}
+    bool is_str_to_nan() const override {return is_str_to_nan_;}
+    string_type nan_to_str() const override {return nan_to_str_;}
+    bool is_str_to_inf() const override {return is_str_to_inf_;}
+    string_type inf_to_str() const override {return inf_to_str_;}
+    bool is_str_to_neginf() const override {return is_str_to_neginf_;}
+    string_type neginf_to_str() const override {return neginf_to_str_;}
+    bool lossless_number() const override {return lossless_number_;}
+    bool structural_index() const override {return structural_index_;}
+};
+
+} // namespace detail
+
 typedef basic_json_options<char> json_options;
 typedef basic_json_options<wchar_t> wjson_options;
 
@@ -20,6 +20,8 @@
 #include <jsoncons/json_content_handler.hpp>
 #include <jsoncons/json_error.hpp>
 #include <jsoncons/detail/parse_number.hpp>
+#include <jsoncons/detail/decimal_to_double.hpp>
+#include <jsoncons/detail/structural_index.hpp>
 
 #define JSONCONS_ILLEGAL_CONTROL_CHARACTER \
         case 0x00:case 0x01:case 0x02:case 0x03:case 0x04:case 0x05:case 0x06:case 0x07:case 0x08:case 0x0b: \
@@ -198,12 +200,22 @@ class basic_json_parser : public ser_context
     const CharT* begin_input_;
     const CharT* input_end_;
     const CharT* input_ptr_;
+    const CharT* number_begin_;
+    uint64_t integer_value_;
+    size_t integer_digits_;
+    bool integer_overflow_;
+    bool number_negative_;
+    CharT* insitu_data_;
+    CharT* insitu_string_begin_;
+    CharT* insitu_write_;
+    bool insitu_string_;
     json_parse_state state_;
     bool continue_;
     bool done_;
+    bool use_index_;
 
     std::basic_string<CharT,std::char_traits<CharT>,char_allocator_type> string_buffer_;
-    jsoncons::detail::string_to_double to_double_;
+    jsoncons::detail::basic_structural_index<CharT,WorkAllocator> index_;
 
     std::vector<json_parse_state,parse_state_allocator_type> state_stack_;
 
@@ -241,10 +253,21 @@ public:
          begin_input_(nullptr),
          input_end_(nullptr),
          input_ptr_(nullptr),
+         number_begin_(nullptr),
+         integer_value_(0),
+         integer_digits_(0),
+         integer_overflow_(false),
+         number_negative_(false),
+         insitu_data_(nullptr),
+         insitu_string_begin_(nullptr),
+         insitu_write_(nullptr),
+         insitu_string_(false),
          state_(json_parse_state::start),
          continue_(true),
          done_(false),
+         use_index_(options.structural_index()),
          string_buffer_(allocator),
+         index_(allocator),
          state_stack_(allocator)
     {
         string_buffer_.reserve(initial_string_buffer_capacity_);
@@ -298,6 +321,15 @@ public:
 
     void skip_space()
     {
+        if (use_index_)
+        {
+            const CharT* p = index_.skip_whitespace(input_ptr_, line_, column_);
+            if (p != input_ptr_)
+            {
+                input_ptr_ = p;
+                return;
+            }
+        }
         const CharT* local_input_end = input_end_;
         while (input_ptr_ != local_input_end) 
         {
@@ -487,6 +519,7 @@ public:
         line_ = 1;
         column_ = 1;
         nesting_depth_ = 0;
+        insitu_string_ = false;
     }
 
     void restart()
@@ -494,6 +527,13 @@ public:
         continue_ = true;
     }
 
+    // Sets the line and column reported for the next character of input
+    void set_position(size_t line, size_t column)
+    {
+        line_ = line;
+        column_ = column;
+    }
+
     void check_done()
     {
         std::error_code ec;
@@ -543,6 +583,19 @@ public:
         begin_input_ = data;
         input_end_ = data + length;
         input_ptr_ = begin_input_;
+        number_begin_ = begin_input_;
+        insitu_data_ = nullptr;
+        if (use_index_)
+        {
+            index_.update(data, length);
+        }
+    }
+
+    // Strings are unescaped in place, string views passed to the handler point into data
+    void update_insitu(CharT* data, size_t length)
+    {
+        update(static_cast<const CharT*>(data), length);
+        insitu_data_ = data;
     }
 
     void parse_some(basic_json_content_handler<CharT>& handler)
@@ -572,6 +625,12 @@ public:
         {
             parse_some_(handler, ec);
         }
+        if (insitu_string_ && input_ptr_ == input_end_)
+        {
+            // The string continues in the next buffer
+            string_buffer_.assign(insitu_string_begin_, insitu_write_ - insitu_string_begin_);
+            insitu_string_ = false;
+        }
     }
 
     void finish_parse(basic_json_content_handler<CharT>& handler)
@@ -713,13 +772,12 @@ public:
                                 state_ = json_parse_state::string;
                                 ++input_ptr_;
                                 ++column_;
-                                string_buffer_.clear();
+                                begin_string();
                                 parse_string(handler, ec);
                                 if (ec) return;
                                 break;
                             case '-':
-                                string_buffer_.clear();
-                                string_buffer_.push_back('-');
+                                begin_number();
                                 ++input_ptr_;
                                 ++column_;
                                 state_ = json_parse_state::minus;
@@ -727,8 +785,7 @@ public:
                                 if (ec) {return;}
                                 break;
                             case '0': 
-                                string_buffer_.clear();
-                                string_buffer_.push_back(static_cast<char>(*input_ptr_));
+                                begin_number();
                                 state_ = json_parse_state::zero;
                                 ++input_ptr_;
                                 ++column_;
@@ -736,10 +793,7 @@ public:
                                 if (ec) {return;}
                                 break;
                             case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
-                                string_buffer_.clear();
-                                string_buffer_.push_back(static_cast<char>(*input_ptr_));
-                                ++input_ptr_;
-                                ++column_;
+                                begin_number();
                                 state_ = json_parse_state::integer;
                                 parse_number(handler, ec);
                                 if (ec) {return;}
@@ -897,7 +951,7 @@ public:
                                 ++column_;
                                 push_state(json_parse_state::member_name);
                                 state_ = json_parse_state::string;
-                                string_buffer_.clear();
+                                begin_string();
                                 parse_string(handler, ec);
                                 if (ec) return;
                                 break;
@@ -963,7 +1017,7 @@ public:
                                 ++column_;
                                 push_state(json_parse_state::member_name);
                                 state_ = json_parse_state::string;
-                                string_buffer_.clear();
+                                begin_string();
                                 parse_string(handler, ec);
                                 if (ec) return;
                                 break;
@@ -1105,13 +1159,12 @@ public:
                                 ++input_ptr_;
                                 ++column_;
                                 state_ = json_parse_state::string;
-                                string_buffer_.clear();
+                                begin_string();
                                 parse_string(handler, ec);
                                 if (ec) return;
                                 break;
                             case '-':
-                                string_buffer_.clear();
-                                string_buffer_.push_back('-');
+                                begin_number();
                                 ++input_ptr_;
                                 ++column_;
                                 state_ = json_parse_state::minus;
@@ -1119,8 +1172,7 @@ public:
                                 if (ec) {return;}
                                 break;
                             case '0': 
-                                string_buffer_.clear();
-                                string_buffer_.push_back(static_cast<char>(*input_ptr_));
+                                begin_number();
                                 ++input_ptr_;
                                 ++column_;
                                 state_ = json_parse_state::zero;
@@ -1128,10 +1180,7 @@ public:
                                 if (ec) {return;}
                                 break;
                             case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
-                                string_buffer_.clear();
-                                string_buffer_.push_back(static_cast<char>(*input_ptr_));
-                                ++input_ptr_;
-                                ++column_;
+                                begin_number();
                                 state_ = json_parse_state::integer;
                                 parse_number(handler, ec);
                                 if (ec) {return;}
@@ -1251,13 +1300,12 @@ public:
                                 ++input_ptr_;
                                 ++column_;
                                 state_ = json_parse_state::string;
-                                string_buffer_.clear();
+                                begin_string();
                                 parse_string(handler, ec);
                                 if (ec) return;
                                 break;
                             case '-':
-                                string_buffer_.clear();
-                                string_buffer_.push_back('-');
+                                begin_number();
                                 ++input_ptr_;
                                 ++column_;
                                 state_ = json_parse_state::minus;
@@ -1265,8 +1313,7 @@ public:
                                 if (ec) {return;}
                                 break;
                             case '0': 
-                                string_buffer_.clear();
-                                string_buffer_.push_back(static_cast<char>(*input_ptr_));
+                                begin_number();
                                 ++input_ptr_;
                                 ++column_;
                                 state_ = json_parse_state::zero;
@@ -1274,10 +1321,7 @@ public:
                                 if (ec) {return;}
                                 break;
                             case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
-                                string_buffer_.clear();
-                                string_buffer_.push_back(static_cast<char>(*input_ptr_));
-                                ++input_ptr_;
-                                ++column_;
+                                begin_number();
                                 state_ = json_parse_state::integer;
                                 parse_number(handler, ec);
                                 if (ec) {return;}
@@ -1740,20 +1784,18 @@ public:
 minus_sign:
         if (JSONCONS_UNLIKELY(input_ptr_ >= local_input_end)) // Buffer exhausted               
         {
+            string_buffer_.append(number_begin_, input_ptr_ - number_begin_);
+            number_begin_ = input_ptr_;
             state_ = json_parse_state::minus;
             return;
         }
         switch (*input_ptr_)
         {
             case '0': 
-                string_buffer_.push_back(static_cast<char>(*input_ptr_));
                 ++input_ptr_;
                 ++column_;
                 goto zero;
             case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
-                string_buffer_.push_back(static_cast<char>(*input_ptr_));
-                ++input_ptr_;
-                ++column_;
                 goto integer;
             default:
                 err_handler_(json_errc::expected_value, *this);
@@ -1764,6 +1806,8 @@ minus_sign:
 zero:
         if (JSONCONS_UNLIKELY(input_ptr_ >= local_input_end)) // Buffer exhausted               
         {
+            string_buffer_.append(number_begin_, input_ptr_ - number_begin_);
+            number_begin_ = input_ptr_;
             state_ = json_parse_state::zero;
             return;
         }
@@ -1808,12 +1852,10 @@ zero:
                 state_ = json_parse_state::expect_comma_or_end;
                 return;
             case '.':
-                string_buffer_.push_back(to_double_.get_decimal_point());
                 ++input_ptr_;
                 ++column_;
                 goto fraction1;
             case 'e':case 'E':
-                string_buffer_.push_back(static_cast<char>(*input_ptr_));
                 ++input_ptr_;
                 ++column_;
                 goto exp1;
@@ -1841,6 +1883,8 @@ zero:
 integer:
         if (JSONCONS_UNLIKELY(input_ptr_ >= local_input_end)) // Buffer exhausted               
         {
+            string_buffer_.append(number_begin_, input_ptr_ - number_begin_);
+            number_begin_ = input_ptr_;
             state_ = json_parse_state::integer;
             return;
         }
@@ -1885,17 +1929,22 @@ integer:
                 state_ = json_parse_state::expect_comma_or_end;
                 return;
             case '0': case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
-                string_buffer_.push_back(static_cast<char>(*input_ptr_));
-                ++input_ptr_;
-                ++column_;
+            {
+                const CharT* p = input_ptr_;
+                p = accumulate_eight_digits(p, local_input_end);
+                for (; p < local_input_end && *p >= '0' && *p <= '9'; ++p)
+                {
+                    accumulate_digit(static_cast<uint64_t>(*p - '0'));
+                }
+                column_ += (p - input_ptr_);
+                input_ptr_ = p;
                 goto integer;
+            }
             case '.':
-                string_buffer_.push_back(to_double_.get_decimal_point());
                 ++input_ptr_;
                 ++column_;
                 goto fraction1;
             case 'e':case 'E':
-                string_buffer_.push_back(static_cast<char>(*input_ptr_));
                 ++input_ptr_;
                 ++column_;
                 goto exp1;
@@ -1917,13 +1966,14 @@ integer:
 fraction1:
         if (JSONCONS_UNLIKELY(input_ptr_ >= local_input_end)) // Buffer exhausted               
         {
+            string_buffer_.append(number_begin_, input_ptr_ - number_begin_);
+            number_begin_ = input_ptr_;
             state_ = json_parse_state::fraction1;
             return;
         }
         switch (*input_ptr_)
         {
             case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
-                string_buffer_.push_back(static_cast<char>(*input_ptr_));
                 ++input_ptr_;
                 ++column_;
                 goto fraction2;
@@ -1937,6 +1987,8 @@ fraction1:
 fraction2:
         if (JSONCONS_UNLIKELY(input_ptr_ >= local_input_end)) // Buffer exhausted               
         {
+            string_buffer_.append(number_begin_, input_ptr_ - number_begin_);
+            number_begin_ = input_ptr_;
             state_ = json_parse_state::fraction2;
             return;
         }
@@ -1989,12 +2041,10 @@ fraction2:
                 ++column_;
                 return;
             case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
-                string_buffer_.push_back(static_cast<char>(*input_ptr_));
                 ++input_ptr_;
                 ++column_;
                 goto fraction2;
             case 'e':case 'E':
-                string_buffer_.push_back(static_cast<char>(*input_ptr_));
                 ++input_ptr_;
                 ++column_;
                 goto exp1;
@@ -2008,6 +2058,8 @@ fraction2:
 exp1:
         if (JSONCONS_UNLIKELY(input_ptr_ >= local_input_end)) // Buffer exhausted               
         {
+            string_buffer_.append(number_begin_, input_ptr_ - number_begin_);
+            number_begin_ = input_ptr_;
             state_ = json_parse_state::exp1;
             return;
         }
@@ -2018,12 +2070,10 @@ exp1:
                 ++column_;
                 goto exp2;
             case '-':
-                string_buffer_.push_back(static_cast<char>(*input_ptr_));
                 ++input_ptr_;
                 ++column_;
                 goto exp2;
             case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
-                string_buffer_.push_back(static_cast<char>(*input_ptr_));
                 ++input_ptr_;
                 ++column_;
                 goto exp3;
@@ -2037,13 +2087,14 @@ exp1:
 exp2:
         if (JSONCONS_UNLIKELY(input_ptr_ >= local_input_end)) // Buffer exhausted               
         {
+            string_buffer_.append(number_begin_, input_ptr_ - number_begin_);
+            number_begin_ = input_ptr_;
             state_ = json_parse_state::exp2;
             return;
         }
         switch (*input_ptr_)
         {
             case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
-                string_buffer_.push_back(static_cast<char>(*input_ptr_));
                 ++input_ptr_;
                 ++column_;
                 goto exp3;
@@ -2058,6 +2109,8 @@ exp2:
 exp3:
         if (JSONCONS_UNLIKELY(input_ptr_ >= local_input_end)) // Buffer exhausted               
         {
+            string_buffer_.append(number_begin_, input_ptr_ - number_begin_);
+            number_begin_ = input_ptr_;
             state_ = json_parse_state::exp3;
             return;
         }
@@ -2110,7 +2163,6 @@ exp3:
                 ++column_;
                 return;
             case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
-                string_buffer_.push_back(static_cast<char>(*input_ptr_));
                 ++input_ptr_;
                 ++column_;
                 goto exp3;
@@ -2163,6 +2215,12 @@ exp3:
 string_u1:
         while (input_ptr_ < local_input_end)
         {
+            input_ptr_ = use_index_ ? index_.find_string_special(input_ptr_)
+                                    : jsoncons::detail::find_string_special(input_ptr_, local_input_end);
+            if (input_ptr_ == local_input_end)
+            {
+                break;
+            }
             switch (*input_ptr_)
             {
                 JSONCONS_ILLEGAL_CONTROL_CHARACTER:
@@ -2176,7 +2234,7 @@ string_u1:
                         return;
                     }
                     // recovery - skip
-                    string_buffer_.append(sb,input_ptr_-sb);
+                    append_to_string(sb,input_ptr_-sb);
                     ++input_ptr_;
                     state_ = json_parse_state::string;
                     return;
@@ -2192,7 +2250,7 @@ string_u1:
                         return;
                     }
                     // recovery - keep
-                    string_buffer_.append(sb, input_ptr_ - sb + 1);
+                    append_to_string(sb, input_ptr_ - sb + 1);
                     ++input_ptr_;
                     push_state(state_);
                     state_ = json_parse_state::cr;
@@ -2210,7 +2268,7 @@ string_u1:
                         return;
                     }
                     // recovery - keep
-                    string_buffer_.append(sb, input_ptr_ - sb + 1);
+                    append_to_string(sb, input_ptr_ - sb + 1);
                     ++input_ptr_;
                     return;
                 }
@@ -2225,21 +2283,28 @@ string_u1:
                         return;
                     }
                     // recovery - keep
-                    string_buffer_.append(sb, input_ptr_ - sb + 1);
+                    append_to_string(sb, input_ptr_ - sb + 1);
                     ++input_ptr_;
                     state_ = json_parse_state::string;
                     return;
                 }
                 case '\\': 
                 {
-                    string_buffer_.append(sb,input_ptr_-sb);
+                    append_to_string(sb,input_ptr_-sb);
                     column_ += (input_ptr_ - sb + 1);
                     ++input_ptr_;
                     goto escape;
                 }
                 case '\"':
                 {
-                    if (string_buffer_.length() == 0)
+                    if (insitu_string_)
+                    {
+                        append_to_string(sb,input_ptr_-sb);
+                        insitu_string_ = false;
+                        end_string_value(insitu_string_begin_,insitu_write_-insitu_string_begin_, handler, ec);
+                        if (ec) {return;}
+                    }
+                    else if (string_buffer_.length() == 0)
                     {
                         end_string_value(sb,input_ptr_-sb, handler, ec);
                         if (ec) {return;}
@@ -2262,7 +2327,7 @@ string_u1:
 
         // Buffer exhausted               
         {
-            string_buffer_.append(sb,input_ptr_-sb);
+            append_to_string(sb,input_ptr_-sb);
             column_ += (input_ptr_ - sb + 1);
             state_ = json_parse_state::string;
             return;
@@ -2277,42 +2342,42 @@ escape:
         switch (*input_ptr_)
         {
         case '\"':
-            string_buffer_.push_back('\"');
+            push_to_string('\"');
             sb = ++input_ptr_;
             ++column_;
             goto string_u1;
         case '\\': 
-            string_buffer_.push_back('\\');
+            push_to_string('\\');
             sb = ++input_ptr_;
             ++column_;
             goto string_u1;
         case '/':
-            string_buffer_.push_back('/');
+            push_to_string('/');
             sb = ++input_ptr_;
             ++column_;
             goto string_u1;
         case 'b':
-            string_buffer_.push_back('\b');
+            push_to_string('\b');
             sb = ++input_ptr_;
             ++column_;
             goto string_u1;
         case 'f':
-            string_buffer_.push_back('\f');
+            push_to_string('\f');
             sb = ++input_ptr_;
             ++column_;
             goto string_u1;
         case 'n':
-            string_buffer_.push_back('\n');
+            push_to_string('\n');
             sb = ++input_ptr_;
             ++column_;
             goto string_u1;
         case 'r':
-            string_buffer_.push_back('\r');
+            push_to_string('\r');
             sb = ++input_ptr_;
             ++column_;
             goto string_u1;
         case 't':
-            string_buffer_.push_back('\t');
+            push_to_string('\t');
             sb = ++input_ptr_;
             ++column_;
             goto string_u1;
@@ -2320,6 +2385,30 @@ escape:
             cp_ = 0;
             ++input_ptr_;
             ++column_;
+            // Fast path when the hex digits are all in the buffer, otherwise
+            // (and for invalid digits) fall through to the state machine
+            if (local_input_end - input_ptr_ >= 4 && jsoncons::detail::decode_hex4(input_ptr_, cp_))
+            {
+                input_ptr_ += 4;
+                column_ += 4;
+                if (!unicons::is_high_surrogate(cp_))
+                {
+                    append_codepoint_to_string(cp_);
+                    sb = input_ptr_;
+                    goto string_u1;
+                }
+                if (local_input_end - input_ptr_ >= 6 && input_ptr_[0] == '\\' && input_ptr_[1] == 'u'
+                    && jsoncons::detail::decode_hex4(input_ptr_ + 2, cp2_))
+                {
+                    uint32_t cp = 0x10000 + ((cp_ & 0x3FF) << 10) + (cp2_ & 0x3FF);
+                    append_codepoint_to_string(cp);
+                    input_ptr_ += 6;
+                    column_ += 6;
+                    sb = input_ptr_;
+                    goto string_u1;
+                }
+                goto escape_expect_surrogate_pair1;
+            }
             goto escape_u1;
         default:    
             err_handler_(json_errc::illegal_escaped_character, *this);
@@ -2404,7 +2493,7 @@ escape_u4:
             }
             else
             {
-                unicons::convert(&cp_, &cp_ + 1, std::back_inserter(string_buffer_));
+                append_codepoint_to_string(cp_);
                 sb = ++input_ptr_;
                 ++column_;
                 state_ = json_parse_state::string;
@@ -2525,7 +2614,7 @@ escape_u9:
                 return;
             }
             uint32_t cp = 0x10000 + ((cp_ & 0x3FF) << 10) + (cp2_ & 0x3FF);
-            unicons::convert(&cp, &cp + 1, std::back_inserter(string_buffer_));
+            append_codepoint_to_string(cp);
             sb = ++input_ptr_;
             ++column_;
             goto string_u1;
@@ -2611,6 +2700,11 @@ escape_u9:
         begin_input_ = data;
         input_end_ = data + length;
         input_ptr_ = begin_input_;
+        number_begin_ = begin_input_;
+        if (use_index_)
+        {
+            index_.update(data, length);
+        }
     }
 #endif
 
@@ -2625,69 +2719,176 @@ escape_u9:
     }
 private:
 
-    void end_integer_value(basic_json_content_handler<CharT>& handler, std::error_code& ec)
+    void begin_string()
+    {
+        string_buffer_.clear();
+        if (insitu_data_ != nullptr)
+        {
+            insitu_string_ = true;
+            insitu_string_begin_ = insitu_data_ + (input_ptr_ - begin_input_);
+            insitu_write_ = insitu_string_begin_;
+        }
+    }
+
+    // In situ, the unescaped string never gets ahead of the input
+    void append_to_string(const CharT* s, size_t length)
     {
-        if (string_buffer_[0] == '-')
+        if (insitu_string_)
         {
-            end_negative_value(handler, ec);
+            if (insitu_write_ != s)
+            {
+                std::memmove(insitu_write_, s, length*sizeof(CharT));
+            }
+            insitu_write_ += length;
         }
         else
         {
-            end_positive_value(handler, ec);
+            string_buffer_.append(s, length);
         }
     }
 
-    void end_negative_value(basic_json_content_handler<CharT>& handler, std::error_code& ec)
+    void push_to_string(CharT c)
     {
-        auto result = jsoncons::detail::to_integer<int64_t>(string_buffer_.data(), string_buffer_.length());
-        if (result.ec == jsoncons::detail::to_integer_errc())
+        if (insitu_string_)
         {
-            continue_ = handler.int64_value(result.value, semantic_tag::none, *this);
+            *insitu_write_++ = c;
         }
-        else // Must be overflow
+        else
         {
-            continue_ = handler.string_value(string_buffer_, semantic_tag::bigint, *this);
+            string_buffer_.push_back(c);
+        }
+    }
+
+    void append_codepoint_to_string(uint32_t cp)
+    {
+        if (insitu_string_)
+        {
+            std::basic_string<CharT> s;
+            unicons::convert(&cp, &cp + 1, std::back_inserter(s));
+            append_to_string(s.data(), s.length());
+        }
+        else
+        {
+            unicons::convert(&cp, &cp + 1, std::back_inserter(string_buffer_));
         }
-        after_value(ec);
     }
 
-    void end_positive_value(basic_json_content_handler<CharT>& handler, std::error_code& ec)
+    void begin_number()
     {
-        auto result = jsoncons::detail::to_integer<uint64_t>(string_buffer_.data(), string_buffer_.length());
-        if (result.ec == jsoncons::detail::to_integer_errc())
+        string_buffer_.clear();
+        number_begin_ = input_ptr_;
+        integer_value_ = 0;
+        integer_digits_ = 0;
+        integer_overflow_ = false;
+        number_negative_ = *input_ptr_ == '-';
+    }
+
+    void accumulate_digit(uint64_t d)
+    {
+        if (integer_digits_ < 19 || 
+            (integer_digits_ == 19 && integer_value_ <= ((std::numeric_limits<uint64_t>::max)() - d)/10))
         {
-            continue_ = handler.uint64_value(result.value, semantic_tag::none, *this);
+            integer_value_ = integer_value_*10 + d;
         }
-        else // Must be overflow
+        else
         {
-            continue_ = handler.string_value(string_buffer_, semantic_tag::bigint, *this);
+            integer_overflow_ = true;
         }
-        after_value(ec);
+        ++integer_digits_;
     }
 
-    void end_fraction_value(basic_json_content_handler<CharT>& handler, std::error_code& ec)
+    const CharT* accumulate_eight_digits(const CharT* p, const CharT* last)
+    {
+        return accumulate_eight_digits(p, last, std::integral_constant<bool,sizeof(CharT) == sizeof(uint8_t)>());
+    }
+
+    const CharT* accumulate_eight_digits(const CharT* p, const CharT* last, std::true_type)
+    {
+        // Up to 19 digits always fit in a uint64_t
+        while (last - p >= 8 && integer_digits_ + 8 <= 19)
+        {
+            uint64_t val = jsoncons::detail::load_eight_chars(p);
+            if (!jsoncons::detail::is_eight_digits(val))
+            {
+                break;
+            }
+            integer_value_ = integer_value_*100000000 + jsoncons::detail::parse_eight_digits(val);
+            integer_digits_ += 8;
+            p += 8;
+        }
+        return p;
+    }
+
+    const CharT* accumulate_eight_digits(const CharT* p, const CharT*, std::false_type)
+    {
+        return p;
+    }
+
+    // The text of the current number, string_buffer_ holds any part read from a previous buffer
+    string_view_type number_text()
+    {
+        if (string_buffer_.empty())
+        {
+            return string_view_type(number_begin_, input_ptr_ - number_begin_);
+        }
+        string_buffer_.append(number_begin_, input_ptr_ - number_begin_);
+        number_begin_ = input_ptr_;
+        return string_view_type(string_buffer_.data(), string_buffer_.length());
+    }
+
+    // The value was accumulated while scanning, text is only needed for a bigint
+    void end_integer_value(basic_json_content_handler<CharT>& handler, std::error_code& ec)
     {
-        JSONCONS_TRY
+        if (JSONCONS_UNLIKELY(integer_overflow_))
+        {
+            continue_ = handler.string_value(number_text(), semantic_tag::bigint, *this);
+        }
+        else if (number_negative_)
         {
-            if (options_.lossless_number())
+            if (integer_value_ == 0)
             {
-                continue_ = handler.string_value(string_buffer_, semantic_tag::bigdec, *this);
+                continue_ = handler.int64_value(0, semantic_tag::none, *this);
+            }
+            else if (integer_value_ - 1 <= static_cast<uint64_t>((std::numeric_limits<int64_t>::max)()))
+            {
+                continue_ = handler.int64_value(-static_cast<int64_t>(integer_value_ - 1) - 1, semantic_tag::none, *this);
             }
             else
             {
-                double d = to_double_(string_buffer_.c_str(), string_buffer_.length());
-                continue_ = handler.double_value(d, semantic_tag::none, *this);
+                continue_ = handler.string_value(number_text(), semantic_tag::bigint, *this);
             }
         }
-        JSONCONS_CATCH(...)
+        else
         {
-            continue_ = err_handler_(json_errc::invalid_number, *this);
-            if (!continue_)
+            continue_ = handler.uint64_value(integer_value_, semantic_tag::none, *this);
+        }
+        after_value(ec);
+    }
+
+    void end_fraction_value(basic_json_content_handler<CharT>& handler, std::error_code& ec)
+    {
+        string_view_type sv = number_text();
+        if (options_.lossless_number())
+        {
+            continue_ = handler.string_value(sv, semantic_tag::bigdec, *this);
+        }
+        else
+        {
+            auto result = jsoncons::detail::decimal_to_double(sv.data(), sv.length());
+            if (JSONCONS_LIKELY(result.valid))
             {
-                ec = json_errc::invalid_number;
-                return;
+                continue_ = handler.double_value(result.value, semantic_tag::none, *this);
+            }
+            else
+            {
+                continue_ = err_handler_(json_errc::invalid_number, *this);
+                if (!continue_)
+                {
+                    ec = json_errc::invalid_number;
+                    return;
+                }
+                continue_ = handler.null_value(semantic_tag::none, *this); // recovery
             }
-            continue_ = handler.null_value(semantic_tag::none, *this); // recovery
         }
 
         after_value(ec);
@@ -0,0 +1,854 @@
+// Copyright 2019 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_TAPE_HPP
+#define JSONCONS_JSON_TAPE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <memory> // std::allocator
+#include <string>
+#include <type_traits> // std::enable_if
+#include <utility> // std::move
+#include <vector>
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/byte_string.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_content_handler.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/unicode_traits.hpp>
+#include <jsoncons/detail/json_view_base.hpp>
+
+namespace jsoncons {
+
+template <class CharT,class Allocator>
+class basic_json_tape;
+
+template <class CharT,class Allocator>
+class basic_json_tape_builder;
+
+template <class CharT,class Allocator>
+class basic_json_tape_member;
+
+namespace detail {
+
+// A tape word holds a type in the top 8 bits, a semantic_tag in the next 8,
+// and a 48 bit payload
+
+enum class tape_type : uint8_t
+{
+    null_value = 'n',
+    true_value = 't',
+    false_value = 'f',
+    int64_value = 'l',
+    uint64_value = 'u',
+    double_value = 'd',
+    string_value = 's',
+    byte_string_value = 'b',
+    key = 'k',
+    begin_array = '[',
+    end_array = ']',
+    begin_object = '{',
+    end_object = '}'
+};
+
+const uint64_t max_tape_payload = (uint64_t(1) << 48) - 1;
+
+inline
+uint64_t make_tape_word(tape_type type, semantic_tag tag, uint64_t payload)
+{
+    return (uint64_t(static_cast<uint8_t>(type)) << 56) | (uint64_t(static_cast<uint8_t>(tag)) << 48) | payload;
+}
+
+inline
+tape_type tape_word_type(uint64_t word)
+{
+    return static_cast<tape_type>(word >> 56);
+}
+
+inline
+semantic_tag tape_word_tag(uint64_t word)
+{
+    return static_cast<semantic_tag>((word >> 48) & 0xff);
+}
+
+inline
+uint64_t tape_word_payload(uint64_t word)
+{
+    return word & max_tape_payload;
+}
+
+}
+
+// basic_json_tape_value
+
+// A read-only view of a value on a basic_json_tape
+
+template <class CharT,class Allocator = std::allocator<char>>
+class basic_json_tape_value
+    : public jsoncons::detail::json_view_base<basic_json_tape_value<CharT,Allocator>,CharT,basic_json_tape_member<CharT,Allocator>>
+{
+    typedef jsoncons::detail::json_view_base<basic_json_tape_value<CharT,Allocator>,CharT,basic_json_tape_member<CharT,Allocator>> base_type;
+public:
+    typedef CharT char_type;
+    typedef std::basic_string<CharT> string_type;
+    typedef basic_string_view<CharT> string_view_type;
+    typedef basic_json_tape<CharT,Allocator> tape_type;
+    typedef basic_json_tape_member<CharT,Allocator> member_type;
+    typedef typename base_type::array_iterator array_iterator;
+    typedef typename base_type::object_iterator object_iterator;
+
+    using base_type::at;
+private:
+    friend class basic_json_tape<CharT,Allocator>;
+    friend class jsoncons::detail::json_view_base<basic_json_tape_value<CharT,Allocator>,CharT,basic_json_tape_member<CharT,Allocator>>;
+
+    const tape_type* tape_;
+    size_t index_;
+
+    basic_json_tape_value(const tape_type* tape, size_t index)
+        : tape_(tape), index_(index)
+    {
+    }
+public:
+    semantic_tag tag() const
+    {
+        return jsoncons::detail::tape_word_tag(word());
+    }
+
+    bool is_null() const
+    {
+        return type() == jsoncons::detail::tape_type::null_value;
+    }
+
+    bool is_bool() const
+    {
+        return type() == jsoncons::detail::tape_type::true_value || type() == jsoncons::detail::tape_type::false_value;
+    }
+
+    bool is_int64() const
+    {
+        return type() == jsoncons::detail::tape_type::int64_value;
+    }
+
+    bool is_uint64() const
+    {
+        return type() == jsoncons::detail::tape_type::uint64_value;
+    }
+
+    bool is_double() const
+    {
+        return type() == jsoncons::detail::tape_type::double_value;
+    }
+
+    bool is_number() const
+    {
+        return is_int64() || is_uint64() || is_double();
+    }
+
+    bool is_string() const
+    {
+        return type() == jsoncons::detail::tape_type::string_value;
+    }
+
+    bool is_byte_string() const
+    {
+        return type() == jsoncons::detail::tape_type::byte_string_value;
+    }
+
+    bool is_array() const
+    {
+        return type() == jsoncons::detail::tape_type::begin_array;
+    }
+
+    bool is_object() const
+    {
+        return type() == jsoncons::detail::tape_type::begin_object;
+    }
+
+    bool empty() const
+    {
+        switch (type())
+        {
+            case jsoncons::detail::tape_type::begin_array:
+            case jsoncons::detail::tape_type::begin_object:
+            case jsoncons::detail::tape_type::string_value:
+            case jsoncons::detail::tape_type::byte_string_value:
+                return size() == 0;
+            default:
+                return false;
+        }
+    }
+
+    // The number of elements, members, or characters or bytes of a string
+    size_t size() const
+    {
+        switch (type())
+        {
+            case jsoncons::detail::tape_type::begin_array:
+            case jsoncons::detail::tape_type::begin_object:
+                return static_cast<size_t>(jsoncons::detail::tape_word_payload(tape_->word(end_index())));
+            case jsoncons::detail::tape_type::string_value:
+            case jsoncons::detail::tape_type::byte_string_value:
+                return static_cast<size_t>(tape_->word(index_ + 1));
+            default:
+                return 0;
+        }
+    }
+
+    basic_json_tape_value at(size_t i) const
+    {
+        if (!is_array())
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Index on non-array value not supported"));
+        }
+        if (i >= size())
+        {
+            JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+        }
+        size_t index = index_ + 1;
+        for (; i > 0; --i)
+        {
+            index = tape_->next(index);
+        }
+        return basic_json_tape_value(tape_, index);
+    }
+
+    bool as_bool() const
+    {
+        switch (type())
+        {
+            case jsoncons::detail::tape_type::true_value:
+                return true;
+            case jsoncons::detail::tape_type::false_value:
+                return false;
+            default:
+                return to_json().as_bool();
+        }
+    }
+
+    double as_double() const
+    {
+        switch (type())
+        {
+            case jsoncons::detail::tape_type::int64_value:
+                return static_cast<double>(int64_payload());
+            case jsoncons::detail::tape_type::uint64_value:
+                return static_cast<double>(tape_->word(index_ + 1));
+            case jsoncons::detail::tape_type::double_value:
+                return double_payload();
+            default:
+                return to_json().as_double();
+        }
+    }
+
+    template <class T>
+    T as_integer() const
+    {
+        switch (type())
+        {
+            case jsoncons::detail::tape_type::int64_value:
+                return static_cast<T>(int64_payload());
+            case jsoncons::detail::tape_type::uint64_value:
+                return static_cast<T>(tape_->word(index_ + 1));
+            case jsoncons::detail::tape_type::double_value:
+                return static_cast<T>(double_payload());
+            default:
+                return to_json().template as_integer<T>();
+        }
+    }
+
+    string_view_type as_string_view() const
+    {
+        if (!is_string())
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Not a string"));
+        }
+        return tape_->string_at(index_);
+    }
+
+    byte_string_view as_byte_string_view() const
+    {
+        if (!is_byte_string())
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Not a byte string"));
+        }
+        return tape_->bytes_at(index_);
+    }
+
+    string_type as_string() const
+    {
+        if (is_string())
+        {
+            string_view_type s = as_string_view();
+            return string_type(s.data(), s.length());
+        }
+        return to_json().as_string();
+    }
+
+    void dump(basic_json_content_handler<CharT>& handler) const
+    {
+        tape_->dump(index_, handler);
+        handler.flush();
+    }
+
+    template <class Json = basic_json<CharT>>
+    Json to_json() const
+    {
+        json_decoder<Json> decoder;
+        tape_->dump(index_, decoder);
+        return decoder.get_result();
+    }
+
+private:
+    uint64_t word() const
+    {
+        return tape_->word(index_);
+    }
+
+    jsoncons::detail::tape_type type() const
+    {
+        return jsoncons::detail::tape_word_type(word());
+    }
+
+    size_t end_index() const
+    {
+        return static_cast<size_t>(jsoncons::detail::tape_word_payload(word()));
+    }
+
+    int64_t int64_payload() const
+    {
+        return static_cast<int64_t>(tape_->word(index_ + 1));
+    }
+
+    double double_payload() const
+    {
+        uint64_t bits = tape_->word(index_ + 1);
+        double val;
+        std::memcpy(&val, &bits, sizeof(double));
+        return val;
+    }
+
+    // Elements are identified by their index on the tape, members by the index of their key
+
+    void element_positions(size_t& first, size_t& last) const
+    {
+        first = index_ + 1;
+        last = end_index();
+    }
+
+    void member_positions(size_t& first, size_t& last) const
+    {
+        first = index_ + 1;
+        last = end_index();
+    }
+
+    basic_json_tape_value element_at(size_t index) const
+    {
+        return basic_json_tape_value(tape_, index);
+    }
+
+    size_t next_element(size_t index) const
+    {
+        return tape_->next(index);
+    }
+
+    member_type member_at(size_t index) const
+    {
+        return member_type(tape_->string_at(index), basic_json_tape_value(tape_, index + 2));
+    }
+
+    size_t next_member(size_t index) const
+    {
+        return tape_->next(index + 2);
+    }
+
+    bool find_member(const string_view_type& name, size_t& index) const
+    {
+        const size_t end = end_index();
+        for (size_t i = index_ + 1; i != end; i = tape_->next(i + 2))
+        {
+            if (tape_->string_at(i) == name)
+            {
+                index = i + 2;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+// basic_json_tape_member
+
+template <class CharT,class Allocator = std::allocator<char>>
+class basic_json_tape_member
+{
+public:
+    typedef basic_string_view<CharT> string_view_type;
+private:
+    string_view_type key_;
+    basic_json_tape_value<CharT,Allocator> value_;
+public:
+    basic_json_tape_member(const string_view_type& key, const basic_json_tape_value<CharT,Allocator>& value)
+        : key_(key), value_(value)
+    {
+    }
+
+    string_view_type key() const
+    {
+        return key_;
+    }
+
+    const basic_json_tape_value<CharT,Allocator>& value() const
+    {
+        return value_;
+    }
+};
+
+// basic_json_tape
+
+// An immutable JSON document stored as one flat tape of 64 bit words, with
+// string and byte string content in separate arenas. Scalars take one or two
+// words, keys and strings two (arena offset and length), and an opening
+// bracket holds the index of its closing bracket, which holds the number of
+// elements or members, so that a subtree can be skipped in one step.
+
+template <class CharT,class Allocator = std::allocator<char>>
+class basic_json_tape
+{
+public:
+    typedef CharT char_type;
+    typedef Allocator allocator_type;
+    typedef basic_string_view<CharT> string_view_type;
+    typedef basic_json_tape_value<CharT,Allocator> value_type;
+private:
+    friend class basic_json_tape_value<CharT,Allocator>;
+    friend class basic_json_tape_builder<CharT,Allocator>;
+
+    typedef typename std::allocator_traits<Allocator>:: template rebind_alloc<uint64_t> word_allocator_type;
+    typedef typename std::allocator_traits<Allocator>:: template rebind_alloc<CharT> char_allocator_type;
+    typedef typename std::allocator_traits<Allocator>:: template rebind_alloc<uint8_t> byte_allocator_type;
+
+    std::vector<uint64_t,word_allocator_type> tape_;
+    std::basic_string<CharT,std::char_traits<CharT>,char_allocator_type> strings_;
+    std::vector<uint8_t,byte_allocator_type> bytes_;
+public:
+    basic_json_tape(const Allocator& allocator = Allocator())
+        : tape_(allocator), strings_(allocator), bytes_(allocator)
+    {
+        tape_.push_back(jsoncons::detail::make_tape_word(jsoncons::detail::tape_type::null_value, semantic_tag::none, 0));
+    }
+
+    basic_json_tape(const basic_json_tape&) = default;
+    basic_json_tape(basic_json_tape&&) = default;
+    basic_json_tape& operator=(const basic_json_tape&) = default;
+    basic_json_tape& operator=(basic_json_tape&&) = default;
+
+    static basic_json_tape parse(const string_view_type& s,
+                                 const basic_json_decode_options<CharT>& options = basic_json_options<CharT>::get_default_options())
+    {
+        basic_json_tape_builder<CharT,Allocator> builder;
+        basic_json_parser<CharT> parser(options);
+
+        auto result = unicons::skip_bom(s.begin(), s.end());
+        if (result.ec != unicons::encoding_errc())
+        {
+            JSONCONS_THROW(ser_error(result.ec));
+        }
+        size_t offset = result.it - s.begin();
+        parser.update(s.data()+offset,s.size()-offset);
+        parser.parse_some(builder);
+        parser.finish_parse(builder);
+        parser.check_done();
+        if (!builder.is_valid())
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Failed to parse json string"));
+        }
+        return builder.get_result();
+    }
+
+    template <class Json>
+    static basic_json_tape from_json(const Json& j)
+    {
+        basic_json_tape_builder<CharT,Allocator> builder;
+        j.dump(builder);
+        return builder.get_result();
+    }
+
+    template <class Json = basic_json<CharT>>
+    Json to_json() const
+    {
+        return root().template to_json<Json>();
+    }
+
+    value_type root() const
+    {
+        return value_type(this, 0);
+    }
+
+    value_type at(const string_view_type& name) const
+    {
+        return root().at(name);
+    }
+
+    value_type operator[](const string_view_type& name) const
+    {
+        return root().at(name);
+    }
+
+    value_type at(size_t i) const
+    {
+        return root().at(i);
+    }
+
+    value_type operator[](size_t i) const
+    {
+        return root().at(i);
+    }
+
+    void dump(basic_json_content_handler<CharT>& handler) const
+    {
+        root().dump(handler);
+    }
+
+    // The number of words on the tape
+    size_t tape_size() const
+    {
+        return tape_.size();
+    }
+
+    // The number of characters in the string arena
+    size_t string_arena_size() const
+    {
+        return strings_.size();
+    }
+
+    void shrink_to_fit()
+    {
+        tape_.shrink_to_fit();
+        strings_.shrink_to_fit();
+        bytes_.shrink_to_fit();
+    }
+
+private:
+    uint64_t word(size_t index) const
+    {
+        return tape_[index];
+    }
+
+    // The index of the value after the one at index
+    size_t next(size_t index) const
+    {
+        switch (jsoncons::detail::tape_word_type(tape_[index]))
+        {
+            case jsoncons::detail::tape_type::null_value:
+            case jsoncons::detail::tape_type::true_value:
+            case jsoncons::detail::tape_type::false_value:
+                return index + 1;
+            case jsoncons::detail::tape_type::begin_array:
+            case jsoncons::detail::tape_type::begin_object:
+                return static_cast<size_t>(jsoncons::detail::tape_word_payload(tape_[index])) + 1;
+            default:
+                return index + 2;
+        }
+    }
+
+    string_view_type string_at(size_t index) const
+    {
+        return string_view_type(strings_.data() + jsoncons::detail::tape_word_payload(tape_[index]),
+                                static_cast<size_t>(tape_[index + 1]));
+    }
+
+    byte_string_view bytes_at(size_t index) const
+    {
+        return byte_string_view(bytes_.data() + jsoncons::detail::tape_word_payload(tape_[index]),
+                                static_cast<size_t>(tape_[index + 1]));
+    }
+
+    // Replays the value at index, the tape is walked in order without a stack
+    void dump(size_t index, basic_json_content_handler<CharT>& handler) const
+    {
+        const size_t end = next(index);
+        while (index < end)
+        {
+            const uint64_t w = tape_[index];
+            const semantic_tag tag = jsoncons::detail::tape_word_tag(w);
+            switch (jsoncons::detail::tape_word_type(w))
+            {
+                case jsoncons::detail::tape_type::null_value:
+                    handler.null_value(tag);
+                    ++index;
+                    break;
+                case jsoncons::detail::tape_type::true_value:
+                    handler.bool_value(true, tag);
+                    ++index;
+                    break;
+                case jsoncons::detail::tape_type::false_value:
+                    handler.bool_value(false, tag);
+                    ++index;
+                    break;
+                case jsoncons::detail::tape_type::int64_value:
+                    handler.int64_value(static_cast<int64_t>(tape_[index + 1]), tag);
+                    index += 2;
+                    break;
+                case jsoncons::detail::tape_type::uint64_value:
+                    handler.uint64_value(tape_[index + 1], tag);
+                    index += 2;
+                    break;
+                case jsoncons::detail::tape_type::double_value:
+                {
+                    uint64_t bits = tape_[index + 1];
+                    double val;
+                    std::memcpy(&val, &bits, sizeof(double));
+                    handler.double_value(val, tag);
+                    index += 2;
+                    break;
+                }
+                case jsoncons::detail::tape_type::string_value:
+                    handler.string_value(string_at(index), tag);
+                    index += 2;
+                    break;
+                case jsoncons::detail::tape_type::byte_string_value:
+                    handler.byte_string_value(bytes_at(index), tag);
+                    index += 2;
+                    break;
+                case jsoncons::detail::tape_type::key:
+                    handler.name(string_at(index));
+                    index += 2;
+                    break;
+                case jsoncons::detail::tape_type::begin_array:
+                    handler.begin_array(static_cast<size_t>(jsoncons::detail::tape_word_payload(tape_[jsoncons::detail::tape_word_payload(w)])), tag);
+                    ++index;
+                    break;
+                case jsoncons::detail::tape_type::end_array:
+                    handler.end_array();
+                    ++index;
+                    break;
+                case jsoncons::detail::tape_type::begin_object:
+                    handler.begin_object(static_cast<size_t>(jsoncons::detail::tape_word_payload(tape_[jsoncons::detail::tape_word_payload(w)])), tag);
+                    ++index;
+                    break;
+                case jsoncons::detail::tape_type::end_object:
+                    handler.end_object();
+                    ++index;
+                    break;
+                default:
+                    JSONCONS_THROW(json_runtime_error<std::runtime_error>("Invalid tape"));
+            }
+        }
+    }
+};
+
+// basic_json_tape_builder
+
+// Appends parse events to a basic_json_tape. The tape and arenas grow
+// geometrically, so no allocation is made per value.
+
+template <class CharT,class Allocator = std::allocator<char>>
+class basic_json_tape_builder : public basic_json_content_handler<CharT>
+{
+public:
+    typedef CharT char_type;
+    typedef Allocator allocator_type;
+    typedef typename basic_json_content_handler<CharT>::string_view_type string_view_type;
+private:
+    struct container
+    {
+        size_t index;
+        size_t count;
+    };
+
+    typedef typename std::allocator_traits<Allocator>:: template rebind_alloc<container> container_allocator_type;
+
+    basic_json_tape<CharT,Allocator> result_;
+    std::vector<container,container_allocator_type> stack_;
+    bool is_valid_;
+public:
+    basic_json_tape_builder(const Allocator& allocator = Allocator())
+        : result_(allocator), stack_(allocator), is_valid_(false)
+    {
+        stack_.reserve(100);
+    }
+
+    bool is_valid() const
+    {
+        return is_valid_;
+    }
+
+    basic_json_tape<CharT,Allocator> get_result()
+    {
+        is_valid_ = false;
+        return std::move(result_);
+    }
+
+private:
+    void do_flush() override
+    {
+    }
+
+    void begin_value()
+    {
+        if (stack_.empty())
+        {
+            result_.tape_.clear();
+            result_.strings_.clear();
+            result_.bytes_.clear();
+            is_valid_ = false;
+        }
+        else
+        {
+            ++stack_.back().count;
+        }
+    }
+
+    bool end_value()
+    {
+        if (stack_.empty())
+        {
+            is_valid_ = true;
+            return false;
+        }
+        return true;
+    }
+
+    void push_word(jsoncons::detail::tape_type type, semantic_tag tag, uint64_t payload)
+    {
+        result_.tape_.push_back(jsoncons::detail::make_tape_word(type, tag, payload));
+    }
+
+    void push_string(jsoncons::detail::tape_type type, const string_view_type& s, semantic_tag tag)
+    {
+        const uint64_t offset = result_.strings_.size();
+        if (offset > jsoncons::detail::max_tape_payload)
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("String arena too large"));
+        }
+        result_.strings_.append(s.data(), s.length());
+        push_word(type, tag, offset);
+        result_.tape_.push_back(s.length());
+    }
+
+    bool begin_container(jsoncons::detail::tape_type type, semantic_tag tag)
+    {
+        begin_value();
+        stack_.push_back(container{result_.tape_.size(), 0});
+        push_word(type, tag, 0);
+        return true;
+    }
+
+    bool end_container(jsoncons::detail::tape_type type)
+    {
+        JSONCONS_ASSERT(!stack_.empty());
+        const container c = stack_.back();
+        stack_.pop_back();
+        const uint64_t end = result_.tape_.size();
+        if (end > jsoncons::detail::max_tape_payload)
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Tape too large"));
+        }
+        result_.tape_[c.index] |= end;
+        push_word(type, semantic_tag::none, c.count);
+        return end_value();
+    }
+
+    bool do_begin_object(semantic_tag tag, const ser_context&) override
+    {
+        return begin_container(jsoncons::detail::tape_type::begin_object, tag);
+    }
+
+    bool do_end_object(const ser_context&) override
+    {
+        return end_container(jsoncons::detail::tape_type::end_object);
+    }
+
+    bool do_begin_array(semantic_tag tag, const ser_context&) override
+    {
+        return begin_container(jsoncons::detail::tape_type::begin_array, tag);
+    }
+
+    bool do_end_array(const ser_context&) override
+    {
+        return end_container(jsoncons::detail::tape_type::end_array);
+    }
+
+    bool do_name(const string_view_type& name, const ser_context&) override
+    {
+        push_string(jsoncons::detail::tape_type::key, name, semantic_tag::none);
+        return true;
+    }
+
+    bool do_string_value(const string_view_type& sv, semantic_tag tag, const ser_context&) override
+    {
+        begin_value();
+        push_string(jsoncons::detail::tape_type::string_value, sv, tag);
+        return end_value();
+    }
+
+    bool do_byte_string_value(const byte_string_view& b, semantic_tag tag, const ser_context&) override
+    {
+        begin_value();
+        const uint64_t offset = result_.bytes_.size();
+        if (offset > jsoncons::detail::max_tape_payload)
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Byte string arena too large"));
+        }
+        result_.bytes_.insert(result_.bytes_.end(), b.begin(), b.end());
+        push_word(jsoncons::detail::tape_type::byte_string_value, tag, offset);
+        result_.tape_.push_back(b.length());
+        return end_value();
+    }
+
+    bool do_double_value(double value, semantic_tag tag, const ser_context&) override
+    {
+        begin_value();
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(double));
+        push_word(jsoncons::detail::tape_type::double_value, tag, 0);
+        result_.tape_.push_back(bits);
+        return end_value();
+    }
+
+    bool do_int64_value(int64_t value, semantic_tag tag, const ser_context&) override
+    {
+        begin_value();
+        push_word(jsoncons::detail::tape_type::int64_value, tag, 0);
+        result_.tape_.push_back(static_cast<uint64_t>(value));
+        return end_value();
+    }
+
+    bool do_uint64_value(uint64_t value, semantic_tag tag, const ser_context&) override
+    {
+        begin_value();
+        push_word(jsoncons::detail::tape_type::uint64_value, tag, 0);
+        result_.tape_.push_back(value);
+        return end_value();
+    }
+
+    bool do_bool_value(bool value, semantic_tag tag, const ser_context&) override
+    {
+        begin_value();
+        push_word(value ? jsoncons::detail::tape_type::true_value : jsoncons::detail::tape_type::false_value, tag, 0);
+        return end_value();
+    }
+
+    bool do_null_value(semantic_tag tag, const ser_context&) override
+    {
+        begin_value();
+        push_word(jsoncons::detail::tape_type::null_value, tag, 0);
+        return end_value();
+    }
+};
+
+typedef basic_json_tape<char> json_tape;
+typedef basic_json_tape<wchar_t> wjson_tape;
+typedef basic_json_tape_builder<char> json_tape_builder;
+typedef basic_json_tape_builder<wchar_t> wjson_tape_builder;
+
+}
+
+#endif
@@ -62,6 +62,9 @@ template<typename T>
 struct unimplemented : std::false_type
 {};
 
+template <class T, class Enable=void>
+struct ser_traits;
+
 template <class Json, class T, class Enable=void>
 struct json_type_traits
 {
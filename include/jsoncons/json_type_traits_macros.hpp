@@ -91,6 +91,70 @@
 #define JSONCONS_VARIADIC_REP_OF_2(Call, Prefix, P2, ...)     JSONCONS_EXPAND_CALL4(Call, Prefix, P2) JSONCONS_EXPAND(JSONCONS_VARIADIC_REP_OF_1(Call, Prefix, __VA_ARGS__)) 
 #define JSONCONS_VARIADIC_REP_OF_1(Call, Prefix, P2)          JSONCONS_EXPAND(Call ## _LAST(Prefix, P2))
 
+// Like JSONCONS_VARIADIC_REP_N, but also passes each call an id, counting down from the number of arguments to 1
+
+#define JSONCONS_EXPAND_CALL5(Call, Prefix, P2, Id) Call(Prefix, P2, Id)
+
+#define JSONCONS_VARIADIC_FOR_EACH(Call, Prefix, ...)            JSONCONS_VARIADIC_FOR_EACH_N(Call, Prefix, JSONCONS_NARGS(__VA_ARGS__), __VA_ARGS__)
+#define JSONCONS_VARIADIC_FOR_EACH_N(Call, Prefix, Count, ...)  JSONCONS_VARIADIC_FOR_EACH_N_(Call, Prefix, Count, __VA_ARGS__)
+#define JSONCONS_VARIADIC_FOR_EACH_N_(Call, Prefix, Count, ...) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_ ## Count(Call, Prefix, __VA_ARGS__))
+
+#define JSONCONS_VARIADIC_FOR_EACH_50(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 50) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_49(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_49(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 49) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_48(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_48(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 48) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_47(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_47(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 47) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_46(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_46(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 46) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_45(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_45(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 45) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_44(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_44(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 44) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_43(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_43(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 43) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_42(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_42(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 42) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_41(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_41(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 41) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_40(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_40(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 40) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_39(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_39(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 39) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_38(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_38(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 38) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_37(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_37(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 37) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_36(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_36(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 36) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_35(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_35(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 35) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_34(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_34(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 34) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_33(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_33(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 33) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_32(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_32(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 32) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_31(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_31(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 31) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_30(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_30(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 30) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_29(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_29(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 29) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_28(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_28(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 28) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_27(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_27(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 27) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_26(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_26(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 26) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_25(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_25(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 25) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_24(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_24(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 24) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_23(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_23(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 23) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_22(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_22(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 22) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_21(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_21(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 21) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_20(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_20(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 20) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_19(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_19(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 19) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_18(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_18(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 18) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_17(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_17(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 17) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_16(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_16(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 16) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_15(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_15(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 15) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_14(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_14(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 14) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_13(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_13(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 13) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_12(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_12(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 12) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_11(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_11(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 11) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_10(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_10(Call, Prefix, P2, ...) JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 10) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_9(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_9(Call, Prefix, P2, ...)  JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 9) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_8(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_8(Call, Prefix, P2, ...)  JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 8) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_7(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_7(Call, Prefix, P2, ...)  JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 7) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_6(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_6(Call, Prefix, P2, ...)  JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 6) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_5(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_5(Call, Prefix, P2, ...)  JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 5) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_4(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_4(Call, Prefix, P2, ...)  JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 4) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_3(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_3(Call, Prefix, P2, ...)  JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 3) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_2(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_2(Call, Prefix, P2, ...)  JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 2) JSONCONS_EXPAND(JSONCONS_VARIADIC_FOR_EACH_1(Call, Prefix, __VA_ARGS__))
+#define JSONCONS_VARIADIC_FOR_EACH_1(Call, Prefix, P2)       JSONCONS_EXPAND_CALL5(Call, Prefix, P2, 1)
+
+// Calls Macro with the elements of the sequence Seq followed by Id
+#define JSONCONS_UNPAREN(...) __VA_ARGS__
+#define JSONCONS_EXPAND_SEQ_ID(Macro, Seq, Id) JSONCONS_EXPAND_SEQ_ID_(Macro, Id, JSONCONS_UNPAREN Seq)
+#define JSONCONS_EXPAND_SEQ_ID_(Macro, Id, ...) JSONCONS_EXPAND(Macro(__VA_ARGS__, Id))
+
 #define JSONCONS_IS(Prefix, Member) if (!ajson.contains(JSONCONS_QUOTE(Prefix, Member))) return false;
 #define JSONCONS_IS_LAST(Prefix, Member) if (!ajson.contains(JSONCONS_QUOTE(Prefix, Member))) return false;
 
@@ -114,7 +178,9 @@
 
 #define JSONCONS_TYPE_TRAITS_FRIEND \
     template <class JSON,class T,class Enable> \
-    friend struct jsoncons::json_type_traits
+    friend struct jsoncons::json_type_traits; \
+    template <class T,class Enable> \
+    friend struct jsoncons::ser_traits
 
 #define JSONCONS_EXPAND_CALL2(Call, Expr, Id) JSONCONS_EXPAND(Call(Expr, Id))
 
@@ -179,6 +245,202 @@
 #define JSONCONS_GENERATE_TPL_ARG(Expr, Id) T ## Id,
 #define JSONCONS_GENERATE_TPL_ARG_LAST(Ex, Id) T ## Id 
 
+// ser_traits specializations that decode a value straight from a staj_reader, and encode it straight 
+// to a json_content_handler, without a json value.
+// Members are given ids, and member_index maps a name to its id, or 0 if it is not a member.
+// member_index switches on the hash of the name, so two names of a type with the same hash 
+// give a duplicate case value error at compile time.
+// deserialize_into reads into an existing value, and resets the members that were not read 
+// to the values of a default constructed one.
+// serialize writes the members in the order a Json object holds them, sorted by name unless 
+// Json preserves order, as encoding through a Json value would.
+
+#define JSONCONS_MEMBER_INDEX(Prefix, Member, Id) case jsoncons::detail::literal_hash(JSONCONS_QUOTE(Prefix, Member)): return jsoncons::detail::name_equals(name, JSONCONS_QUOTE(Prefix, Member)) ? Id : 0;
+#define JSONCONS_MEMBER_READ(Prefix, Member, Id) case Id: read_into(Json(), reader, aval.Member, ec); break;
+#define JSONCONS_MEMBER_REQUIRED(Prefix, Member, Id) if (!(found & (uint64_t(1) << (Id-1)))) {jsoncons::detail::throw_key_not_found(JSONCONS_QUOTE(Prefix, Member));}
+#define JSONCONS_MEMBER_NOT_REQUIRED(Prefix, Member, Id)
+#define JSONCONS_MEMBER_RESET(Prefix, Member, Id) if (!(found & (uint64_t(1) << (Id-1)))) {aval.Member = defaults.Member;}
+#define JSONCONS_MEMBER_WRITE(Prefix, Member, Id) case Id: jsoncons::detail::encode_name(receiver, JSONCONS_QUOTE(Prefix, Member)); write_to(Json(), aval.Member, receiver); break;
+#define JSONCONS_MEMBER_NAME(Prefix, Member) JSONCONS_QUOTE(Prefix, Member),
+#define JSONCONS_MEMBER_NAME_LAST(Prefix, Member) JSONCONS_QUOTE(Prefix, Member)
+
+#define JSONCONS_NAMED_MEMBER_INDEX(Prefix, Seq, Id) JSONCONS_EXPAND_SEQ_ID(JSONCONS_NAMED_MEMBER_INDEX_, Seq, Id)
+#define JSONCONS_NAMED_MEMBER_INDEX_(Member, Name, Id) case jsoncons::detail::literal_hash(Name): return jsoncons::detail::name_equals(name, Name) ? Id : 0;
+#define JSONCONS_NAMED_MEMBER_READ(Prefix, Seq, Id) JSONCONS_EXPAND_SEQ_ID(JSONCONS_NAMED_MEMBER_READ_, Seq, Id)
+#define JSONCONS_NAMED_MEMBER_READ_(Member, Name, Id) case Id: read_into(Json(), reader, aval.Member, ec); break;
+#define JSONCONS_NAMED_MEMBER_REQUIRED(Prefix, Seq, Id) JSONCONS_EXPAND_SEQ_ID(JSONCONS_NAMED_MEMBER_REQUIRED_, Seq, Id)
+#define JSONCONS_NAMED_MEMBER_REQUIRED_(Member, Name, Id) if (!(found & (uint64_t(1) << (Id-1)))) {jsoncons::detail::throw_key_not_found(Name);}
+#define JSONCONS_NAMED_MEMBER_NOT_REQUIRED(Prefix, Seq, Id)
+#define JSONCONS_NAMED_MEMBER_RESET(Prefix, Seq, Id) JSONCONS_EXPAND_SEQ_ID(JSONCONS_NAMED_MEMBER_RESET_, Seq, Id)
+#define JSONCONS_NAMED_MEMBER_RESET_(Member, Name, Id) if (!(found & (uint64_t(1) << (Id-1)))) {aval.Member = defaults.Member;}
+#define JSONCONS_NAMED_MEMBER_WRITE(Prefix, Seq, Id) JSONCONS_EXPAND_SEQ_ID(JSONCONS_NAMED_MEMBER_WRITE_, Seq, Id)
+#define JSONCONS_NAMED_MEMBER_WRITE_(Member, Name, Id) case Id: jsoncons::detail::encode_name(receiver, Name); write_to(Json(), aval.Member, receiver); break;
+#define JSONCONS_NAMED_MEMBER_NAME(Prefix, Seq) JSONCONS_EXPAND(JSONCONS_NAMED_MEMBER_NAME_ Seq),
+#define JSONCONS_NAMED_MEMBER_NAME_LAST(Prefix, Seq) JSONCONS_EXPAND(JSONCONS_NAMED_MEMBER_NAME_ Seq)
+#define JSONCONS_NAMED_MEMBER_NAME_(Member, Name) Name
+
+#define JSONCONS_GETTER_SETTER_READ(Prefix, Seq, Id) JSONCONS_EXPAND_SEQ_ID(JSONCONS_GETTER_SETTER_READ_, Seq, Id)
+#define JSONCONS_GETTER_SETTER_READ_(Getter, Setter, Name, Id) case Id: aval.Setter(read_from<typename std::decay<decltype(aval.Getter())>::type>(Json(), reader, ec)); break;
+#define JSONCONS_GETTER_SETTER_INDEX(Prefix, Seq, Id) JSONCONS_EXPAND_SEQ_ID(JSONCONS_GETTER_SETTER_INDEX_, Seq, Id)
+#define JSONCONS_GETTER_SETTER_INDEX_(Getter, Setter, Name, Id) case jsoncons::detail::literal_hash(Name): return jsoncons::detail::name_equals(name, Name) ? Id : 0;
+#define JSONCONS_GETTER_SETTER_REQUIRED(Prefix, Seq, Id) JSONCONS_EXPAND_SEQ_ID(JSONCONS_GETTER_SETTER_REQUIRED_, Seq, Id)
+#define JSONCONS_GETTER_SETTER_REQUIRED_(Getter, Setter, Name, Id) if (!(found & (uint64_t(1) << (Id-1)))) {jsoncons::detail::throw_key_not_found(Name);}
+#define JSONCONS_GETTER_SETTER_NOT_REQUIRED(Prefix, Seq, Id)
+#define JSONCONS_GETTER_SETTER_RESET(Prefix, Seq, Id) JSONCONS_EXPAND_SEQ_ID(JSONCONS_GETTER_SETTER_RESET_, Seq, Id)
+#define JSONCONS_GETTER_SETTER_RESET_(Getter, Setter, Name, Id) if (!(found & (uint64_t(1) << (Id-1)))) {aval.Setter(defaults.Getter());}
+#define JSONCONS_GETTER_SETTER_WRITE(Prefix, Seq, Id) JSONCONS_EXPAND_SEQ_ID(JSONCONS_GETTER_SETTER_WRITE_, Seq, Id)
+#define JSONCONS_GETTER_SETTER_WRITE_(Getter, Setter, Name, Id) case Id: jsoncons::detail::encode_name(receiver, Name); write_to(Json(), aval.Getter(), receiver); break;
+#define JSONCONS_GETTER_SETTER_NAME(Prefix, Seq) JSONCONS_EXPAND(JSONCONS_GETTER_SETTER_NAME_ Seq),
+#define JSONCONS_GETTER_SETTER_NAME_LAST(Prefix, Seq) JSONCONS_EXPAND(JSONCONS_GETTER_SETTER_NAME_ Seq)
+#define JSONCONS_GETTER_SETTER_NAME_(Getter, Setter, Name) Name
+
+#define JSONCONS_MEMBER_SER_TRAITS_DECL_BASE(Index, Read, Check, Reset, Name, Write, Prefix, NumTemplateParams, ValueType, ...)  \
+namespace jsoncons \
+{ \
+    template<typename Enable JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_TPL_PARAM, NumTemplateParams)> \
+    struct ser_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams), Enable> \
+    { \
+        typedef ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams) value_type; \
+        template <class CharT> \
+        static int member_index(const basic_string_view<CharT>& name) \
+        { \
+            switch (jsoncons::detail::name_hash(name)) \
+            { \
+                JSONCONS_VARIADIC_FOR_EACH(Index, Prefix, __VA_ARGS__) \
+                default: return 0; \
+            } \
+        } \
+        template <class CharT, class Json> \
+        static uint64_t read_members(basic_staj_reader<CharT>& reader, value_type& aval, std::error_code& ec) \
+        { \
+            uint64_t found = jsoncons::detail::read_members(reader, ec, member_index<CharT>, \
+                [&](int id) \
+                { \
+                    switch (id) \
+                    { \
+                        JSONCONS_VARIADIC_FOR_EACH(Read, Prefix, __VA_ARGS__) \
+                        default: break; \
+                    } \
+                }); \
+            if (!ec) \
+            { \
+                JSONCONS_VARIADIC_FOR_EACH(Check, Prefix, __VA_ARGS__) \
+            } \
+            return found; \
+        } \
+        template <class CharT, class Json> \
+        static value_type deserialize(basic_staj_reader<CharT>& reader, std::error_code& ec) \
+        { \
+            value_type aval{}; \
+            read_members<CharT,Json>(reader, aval, ec); \
+            return aval; \
+        } \
+        template <class CharT, class Json> \
+        static void deserialize_into(basic_staj_reader<CharT>& reader, value_type& aval, std::error_code& ec) \
+        { \
+            uint64_t found = read_members<CharT,Json>(reader, aval, ec); \
+            if (!ec && found != (~uint64_t(0) >> (64 - JSONCONS_NARGS(__VA_ARGS__)))) \
+            { \
+                const value_type defaults{}; \
+                JSONCONS_VARIADIC_FOR_EACH(Reset, Prefix, __VA_ARGS__) \
+            } \
+        } \
+        template <class CharT, class Json> \
+        static void serialize(const value_type& aval, basic_json_content_handler<CharT>& receiver) \
+        { \
+            static const auto order = jsoncons::detail::member_order<CharT,Json,JSONCONS_NARGS(__VA_ARGS__)>({JSONCONS_VARIADIC_REP_N(Name, Prefix, __VA_ARGS__)}); \
+            receiver.begin_object(JSONCONS_NARGS(__VA_ARGS__)); \
+            for (size_t i : order) \
+            { \
+                switch (JSONCONS_NARGS(__VA_ARGS__) - i) \
+                { \
+                    JSONCONS_VARIADIC_FOR_EACH(Write, Prefix, __VA_ARGS__) \
+                    default: break; \
+                } \
+            } \
+            receiver.end_object(); \
+        } \
+    }; \
+} \
+  /**/
+
+#define JSONCONS_GETTER_CTOR_SLOT(Prefix, Member, Id) jsoncons::detail::member_slot<typename std::decay<decltype(std::declval<const value_type&>().Member())>::type> Member ## _slot;
+#define JSONCONS_GETTER_CTOR_READ(Prefix, Member, Id) case Id: Member ## _slot.emplace(read_from<typename std::decay<decltype(std::declval<const value_type&>().Member())>::type>(Json(), reader, ec)); break;
+#define JSONCONS_GETTER_CTOR_ARG(Prefix, Member) std::move(Member ## _slot.value()),
+#define JSONCONS_GETTER_CTOR_ARG_LAST(Prefix, Member) std::move(Member ## _slot.value())
+#define JSONCONS_GETTER_CTOR_WRITE(Prefix, Member, Id) case Id: jsoncons::detail::encode_name(receiver, JSONCONS_QUOTE(Prefix, Member)); write_to(Json(), aval.Member(), receiver); break;
+
+#define JSONCONS_GETTER_CTOR_NAMED_SLOT(Prefix, Seq, Id) JSONCONS_EXPAND_SEQ_ID(JSONCONS_GETTER_CTOR_SLOT_, Seq, Id)
+#define JSONCONS_GETTER_CTOR_SLOT_(Member, Name, Id) JSONCONS_GETTER_CTOR_SLOT(, Member, Id)
+#define JSONCONS_GETTER_CTOR_NAMED_READ(Prefix, Seq, Id) JSONCONS_EXPAND_SEQ_ID(JSONCONS_GETTER_CTOR_READ_, Seq, Id)
+#define JSONCONS_GETTER_CTOR_READ_(Member, Name, Id) JSONCONS_GETTER_CTOR_READ(, Member, Id)
+#define JSONCONS_GETTER_CTOR_NAMED_ARG(Prefix, Seq) JSONCONS_EXPAND(JSONCONS_GETTER_CTOR_NAMED_ARG_ Seq),
+#define JSONCONS_GETTER_CTOR_NAMED_ARG_LAST(Prefix, Seq) JSONCONS_EXPAND(JSONCONS_GETTER_CTOR_NAMED_ARG_ Seq)
+#define JSONCONS_GETTER_CTOR_NAMED_ARG_(Member, Name) std::move(Member ## _slot.value())
+#define JSONCONS_GETTER_CTOR_NAMED_WRITE(Prefix, Seq, Id) JSONCONS_EXPAND_SEQ_ID(JSONCONS_GETTER_CTOR_WRITE_, Seq, Id)
+#define JSONCONS_GETTER_CTOR_WRITE_(Member, Name, Id) case Id: jsoncons::detail::encode_name(receiver, Name); write_to(Json(), aval.Member(), receiver); break;
+
+// All members are required, and are held in slots until the value can be constructed 
+#define JSONCONS_GETTER_CTOR_SER_TRAITS_DECL_BASE(Index, Slot, Read, Check, Arg, Name, Write, Prefix, NumTemplateParams, ValueType, ...)  \
+namespace jsoncons \
+{ \
+    template<typename Enable JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_TPL_PARAM, NumTemplateParams)> \
+    struct ser_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams), Enable> \
+    { \
+        typedef ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams) value_type; \
+        template <class CharT> \
+        static int member_index(const basic_string_view<CharT>& name) \
+        { \
+            switch (jsoncons::detail::name_hash(name)) \
+            { \
+                JSONCONS_VARIADIC_FOR_EACH(Index, Prefix, __VA_ARGS__) \
+                default: return 0; \
+            } \
+        } \
+        template <class CharT, class Json> \
+        static value_type deserialize(basic_staj_reader<CharT>& reader, std::error_code& ec) \
+        { \
+            JSONCONS_VARIADIC_FOR_EACH(Slot, Prefix, __VA_ARGS__) \
+            uint64_t found = jsoncons::detail::read_members(reader, ec, member_index<CharT>, \
+                [&](int id) \
+                { \
+                    switch (id) \
+                    { \
+                        JSONCONS_VARIADIC_FOR_EACH(Read, Prefix, __VA_ARGS__) \
+                        default: break; \
+                    } \
+                }); \
+            if (ec) \
+            { \
+                JSONCONS_THROW(ser_error(ec, reader.context().line(), reader.context().column())); \
+            } \
+            JSONCONS_VARIADIC_FOR_EACH(Check, Prefix, __VA_ARGS__) \
+            return value_type(JSONCONS_VARIADIC_REP_N(Arg, Prefix, __VA_ARGS__)); \
+        } \
+        template <class CharT, class Json> \
+        static void deserialize_into(basic_staj_reader<CharT>& reader, value_type& aval, std::error_code& ec) \
+        { \
+            aval = deserialize<CharT,Json>(reader, ec); \
+        } \
+        template <class CharT, class Json> \
+        static void serialize(const value_type& aval, basic_json_content_handler<CharT>& receiver) \
+        { \
+            static const auto order = jsoncons::detail::member_order<CharT,Json,JSONCONS_NARGS(__VA_ARGS__)>({JSONCONS_VARIADIC_REP_N(Name, Prefix, __VA_ARGS__)}); \
+            receiver.begin_object(JSONCONS_NARGS(__VA_ARGS__)); \
+            for (size_t i : order) \
+            { \
+                switch (JSONCONS_NARGS(__VA_ARGS__) - i) \
+                { \
+                    JSONCONS_VARIADIC_FOR_EACH(Write, Prefix, __VA_ARGS__) \
+                    default: break; \
+                } \
+            } \
+            receiver.end_object(); \
+        } \
+    }; \
+} \
+  /**/
+
 #define JSONCONS_MEMBER_TRAITS_DECL_BASE(As,CharT,Prefix,NumTemplateParams, ValueType, ...)  \
 namespace jsoncons \
 { \
@@ -212,22 +474,26 @@ namespace jsoncons \
 #define JSONCONS_MEMBER_TRAITS_DECL(ValueType, ...)  \
     JSONCONS_MEMBER_TRAITS_DECL_BASE(JSONCONS_AS, char,,0, ValueType, __VA_ARGS__) \
     JSONCONS_MEMBER_TRAITS_DECL_BASE(JSONCONS_AS, wchar_t,L,0, ValueType, __VA_ARGS__) \
+    JSONCONS_MEMBER_SER_TRAITS_DECL_BASE(JSONCONS_MEMBER_INDEX, JSONCONS_MEMBER_READ, JSONCONS_MEMBER_NOT_REQUIRED, JSONCONS_MEMBER_RESET, JSONCONS_MEMBER_NAME, JSONCONS_MEMBER_WRITE, ,0, ValueType, __VA_ARGS__) \
   /**/
 
 #define JSONCONS_TPL_MEMBER_TRAITS_DECL(NumTemplateParams, ValueType, ...)  \
     JSONCONS_MEMBER_TRAITS_DECL_BASE(JSONCONS_AS, char,,NumTemplateParams, ValueType, __VA_ARGS__) \
     JSONCONS_MEMBER_TRAITS_DECL_BASE(JSONCONS_AS, wchar_t,L,NumTemplateParams, ValueType, __VA_ARGS__) \
+    JSONCONS_MEMBER_SER_TRAITS_DECL_BASE(JSONCONS_MEMBER_INDEX, JSONCONS_MEMBER_READ, JSONCONS_MEMBER_NOT_REQUIRED, JSONCONS_MEMBER_RESET, JSONCONS_MEMBER_NAME, JSONCONS_MEMBER_WRITE, ,NumTemplateParams, ValueType, __VA_ARGS__) \
   /**/
 
 
 #define JSONCONS_STRICT_MEMBER_TRAITS_DECL(ValueType, ...)  \
     JSONCONS_MEMBER_TRAITS_DECL_BASE(JSONCONS_STRICT_AS,char,,0,ValueType,__VA_ARGS__) \
     JSONCONS_MEMBER_TRAITS_DECL_BASE(JSONCONS_STRICT_AS,wchar_t,L,0,ValueType,__VA_ARGS__) \
+    JSONCONS_MEMBER_SER_TRAITS_DECL_BASE(JSONCONS_MEMBER_INDEX, JSONCONS_MEMBER_READ, JSONCONS_MEMBER_REQUIRED, JSONCONS_MEMBER_RESET, JSONCONS_MEMBER_NAME, JSONCONS_MEMBER_WRITE, ,0, ValueType, __VA_ARGS__) \
   /**/
 
 #define JSONCONS_STRICT_TPL_MEMBER_TRAITS_DECL(NumTemplateParams, ValueType, ...)  \
     JSONCONS_MEMBER_TRAITS_DECL_BASE(JSONCONS_STRICT_AS,char,,NumTemplateParams,ValueType,__VA_ARGS__) \
     JSONCONS_MEMBER_TRAITS_DECL_BASE(JSONCONS_STRICT_AS,wchar_t,L,NumTemplateParams,ValueType,__VA_ARGS__) \
+    JSONCONS_MEMBER_SER_TRAITS_DECL_BASE(JSONCONS_MEMBER_INDEX, JSONCONS_MEMBER_READ, JSONCONS_MEMBER_REQUIRED, JSONCONS_MEMBER_RESET, JSONCONS_MEMBER_NAME, JSONCONS_MEMBER_WRITE, ,NumTemplateParams, ValueType, __VA_ARGS__) \
   /**/
  
 #define JSONCONS_GETTER_CTOR_TRAITS_DECL_BASE(CharT,Prefix,NumTemplateParams, ValueType, ...)  \
@@ -261,16 +527,78 @@ namespace jsoncons \
 #define JSONCONS_GETTER_CTOR_TRAITS_DECL(ValueType, ...)  \
 JSONCONS_GETTER_CTOR_TRAITS_DECL_BASE(char,,0, ValueType, __VA_ARGS__) \
 JSONCONS_GETTER_CTOR_TRAITS_DECL_BASE(wchar_t,L,0, ValueType, __VA_ARGS__) \
+JSONCONS_GETTER_CTOR_SER_TRAITS_DECL_BASE(JSONCONS_MEMBER_INDEX, JSONCONS_GETTER_CTOR_SLOT, JSONCONS_GETTER_CTOR_READ, JSONCONS_MEMBER_REQUIRED, JSONCONS_GETTER_CTOR_ARG, JSONCONS_MEMBER_NAME, JSONCONS_GETTER_CTOR_WRITE, ,0, ValueType, __VA_ARGS__) \
   /**/
  
 #define JSONCONS_TPL_GETTER_CTOR_TRAITS_DECL(NumTemplateParams, ValueType, ...)  \
 JSONCONS_GETTER_CTOR_TRAITS_DECL_BASE(char,,NumTemplateParams, ValueType, __VA_ARGS__) \
 JSONCONS_GETTER_CTOR_TRAITS_DECL_BASE(wchar_t,L,NumTemplateParams, ValueType, __VA_ARGS__) \
+JSONCONS_GETTER_CTOR_SER_TRAITS_DECL_BASE(JSONCONS_MEMBER_INDEX, JSONCONS_GETTER_CTOR_SLOT, JSONCONS_GETTER_CTOR_READ, JSONCONS_MEMBER_REQUIRED, JSONCONS_GETTER_CTOR_ARG, JSONCONS_MEMBER_NAME, JSONCONS_GETTER_CTOR_WRITE, ,NumTemplateParams, ValueType, __VA_ARGS__) \
   /**/
 
 #define JSONCONS_ENUM_PAIR(Prefix, Member) {value_type::Member, JSONCONS_QUOTE(Prefix,Member)},
 #define JSONCONS_ENUM_PAIR_LAST(Prefix, Member) {value_type::Member, JSONCONS_QUOTE(Prefix,Member)}
 
+// ser_traits specialization for an enum, which maps a name to its enumerator by switching on the hash of the name
+
+#define JSONCONS_ENUM_INDEX(Prefix, Member, Id) case jsoncons::detail::literal_hash(JSONCONS_QUOTE(Prefix, Member)): if (jsoncons::detail::name_equals(name, JSONCONS_QUOTE(Prefix, Member))) {val = value_type::Member; return true;} return false;
+#define JSONCONS_ENUM_WRITE(Prefix, Member, Id) if (aval == value_type::Member) {jsoncons::detail::encode_string(receiver, JSONCONS_QUOTE(Prefix, Member)); return;}
+
+#define JSONCONS_NAMED_ENUM_INDEX(Prefix, Seq, Id) JSONCONS_EXPAND_SEQ_ID(JSONCONS_NAMED_ENUM_INDEX_, Seq, Id)
+#define JSONCONS_NAMED_ENUM_INDEX_(Member, Name, Id) case jsoncons::detail::literal_hash(Name): if (jsoncons::detail::name_equals(name, Name)) {val = value_type::Member; return true;} return false;
+#define JSONCONS_NAMED_ENUM_WRITE(Prefix, Seq, Id) JSONCONS_EXPAND_SEQ_ID(JSONCONS_NAMED_ENUM_WRITE_, Seq, Id)
+#define JSONCONS_NAMED_ENUM_WRITE_(Member, Name, Id) if (aval == value_type::Member) {jsoncons::detail::encode_string(receiver, Name); return;}
+
+#define JSONCONS_ENUM_SER_TRAITS_DECL_BASE(Index, Write, EnumType, ...)  \
+namespace jsoncons \
+{ \
+    template<typename Enable> \
+    struct ser_traits<EnumType, Enable> \
+    { \
+        typedef EnumType value_type; \
+        template <class CharT> \
+        static bool find(const basic_string_view<CharT>& name, value_type& val) \
+        { \
+            switch (jsoncons::detail::name_hash(name)) \
+            { \
+                JSONCONS_VARIADIC_FOR_EACH(Index, , __VA_ARGS__) \
+                default: return false; \
+            } \
+        } \
+        template <class CharT, class Json> \
+        static value_type deserialize(basic_staj_reader<CharT>& reader, std::error_code&) \
+        { \
+            if (reader.current().event_type() != staj_event_type::string_value) \
+            { \
+                JSONCONS_THROW(json_runtime_error<std::runtime_error>("Not an enum")); \
+            } \
+            const auto s = reader.current().template get<basic_string_view<CharT>>(); \
+            value_type val{}; \
+            if (!find(s, val) && !s.empty()) \
+            { \
+                JSONCONS_THROW(json_runtime_error<std::runtime_error>("Not an enum")); \
+            } \
+            return val; \
+        } \
+        template <class CharT, class Json> \
+        static void deserialize_into(basic_staj_reader<CharT>& reader, value_type& aval, std::error_code& ec) \
+        { \
+            aval = deserialize<CharT,Json>(reader, ec); \
+        } \
+        template <class CharT, class Json> \
+        static void serialize(const value_type& aval, basic_json_content_handler<CharT>& receiver) \
+        { \
+            JSONCONS_VARIADIC_FOR_EACH(Write, , __VA_ARGS__) \
+            if (aval != value_type()) \
+            { \
+                JSONCONS_THROW(json_runtime_error<std::runtime_error>("Not an enum")); \
+            } \
+            receiver.string_value(basic_string_view<CharT>()); \
+        } \
+    }; \
+} \
+    /**/
+
 #define JSONCONS_ENUM_TRAITS_DECL_BASE(CharT,Prefix,EnumType, ...)  \
 namespace jsoncons \
 { \
@@ -368,6 +696,7 @@ namespace jsoncons \
 #define JSONCONS_ENUM_TRAITS_DECL(EnumType, ...)  \
     JSONCONS_ENUM_TRAITS_DECL_BASE(char,,EnumType,__VA_ARGS__) \
     JSONCONS_ENUM_TRAITS_DECL_BASE(wchar_t,L,EnumType,__VA_ARGS__) \
+    JSONCONS_ENUM_SER_TRAITS_DECL_BASE(JSONCONS_ENUM_INDEX, JSONCONS_ENUM_WRITE, EnumType, __VA_ARGS__) \
     /**/
 
 #define JSONCONS_NAMED_IS(Prefix, Seq) JSONCONS_EXPAND(JSONCONS_NAMED_IS_ Seq)
@@ -419,18 +748,22 @@ namespace jsoncons \
 
 #define JSONCONS_MEMBER_NAMED_TRAITS_DECL(ValueType, ...)  \
     JSONCONS_MEMBER_NAMED_TRAITS_DECL_BASE(JSONCONS_NAMED_AS, 0, ValueType, __VA_ARGS__) \
+    JSONCONS_MEMBER_SER_TRAITS_DECL_BASE(JSONCONS_NAMED_MEMBER_INDEX, JSONCONS_NAMED_MEMBER_READ, JSONCONS_NAMED_MEMBER_NOT_REQUIRED, JSONCONS_NAMED_MEMBER_RESET, JSONCONS_NAMED_MEMBER_NAME, JSONCONS_NAMED_MEMBER_WRITE, ,0, ValueType, __VA_ARGS__) \
   /**/
 
 #define JSONCONS_TPL_MEMBER_NAMED_TRAITS_DECL(NumTemplateParams, ValueType, ...)  \
     JSONCONS_MEMBER_NAMED_TRAITS_DECL_BASE(JSONCONS_NAMED_AS, NumTemplateParams, ValueType, __VA_ARGS__) \
+    JSONCONS_MEMBER_SER_TRAITS_DECL_BASE(JSONCONS_NAMED_MEMBER_INDEX, JSONCONS_NAMED_MEMBER_READ, JSONCONS_NAMED_MEMBER_NOT_REQUIRED, JSONCONS_NAMED_MEMBER_RESET, JSONCONS_NAMED_MEMBER_NAME, JSONCONS_NAMED_MEMBER_WRITE, ,NumTemplateParams, ValueType, __VA_ARGS__) \
   /**/
 
 #define JSONCONS_STRICT_MEMBER_NAMED_TRAITS_DECL(ValueType, ...)  \
     JSONCONS_MEMBER_NAMED_TRAITS_DECL_BASE(JSONCONS_STRICT_NAMED_AS, 0, ValueType, __VA_ARGS__) \
+    JSONCONS_MEMBER_SER_TRAITS_DECL_BASE(JSONCONS_NAMED_MEMBER_INDEX, JSONCONS_NAMED_MEMBER_READ, JSONCONS_NAMED_MEMBER_REQUIRED, JSONCONS_NAMED_MEMBER_RESET, JSONCONS_NAMED_MEMBER_NAME, JSONCONS_NAMED_MEMBER_WRITE, ,0, ValueType, __VA_ARGS__) \
   /**/
 
 #define JSONCONS_STRICT_TPL_MEMBER_NAMED_TRAITS_DECL(NumTemplateParams, ValueType, ...)  \
     JSONCONS_MEMBER_NAMED_TRAITS_DECL_BASE(JSONCONS_STRICT_NAMED_AS, NumTemplateParams, ValueType, __VA_ARGS__) \
+    JSONCONS_MEMBER_SER_TRAITS_DECL_BASE(JSONCONS_NAMED_MEMBER_INDEX, JSONCONS_NAMED_MEMBER_READ, JSONCONS_NAMED_MEMBER_REQUIRED, JSONCONS_NAMED_MEMBER_RESET, JSONCONS_NAMED_MEMBER_NAME, JSONCONS_NAMED_MEMBER_WRITE, ,NumTemplateParams, ValueType, __VA_ARGS__) \
   /**/
 
 
@@ -531,6 +864,7 @@ namespace jsoncons \
         } \
     }; \
 } \
+JSONCONS_ENUM_SER_TRAITS_DECL_BASE(JSONCONS_NAMED_ENUM_INDEX, JSONCONS_NAMED_ENUM_WRITE, EnumType, __VA_ARGS__) \
     /**/
  
 #define JSONCONS_GETTER_CTOR_NAMED_IS(Prefix, Seq) JSONCONS_EXPAND(JSONCONS_GETTER_CTOR_NAMED_IS_ Seq)
@@ -575,10 +909,12 @@ namespace jsoncons \
  
 #define JSONCONS_GETTER_CTOR_NAMED_TRAITS_DECL(ValueType, ...)  \
 JSONCONS_GETTER_CTOR_NAMED_TRAITS_DECL_BASE(0, ValueType, __VA_ARGS__) \
+JSONCONS_GETTER_CTOR_SER_TRAITS_DECL_BASE(JSONCONS_NAMED_MEMBER_INDEX, JSONCONS_GETTER_CTOR_NAMED_SLOT, JSONCONS_GETTER_CTOR_NAMED_READ, JSONCONS_NAMED_MEMBER_REQUIRED, JSONCONS_GETTER_CTOR_NAMED_ARG, JSONCONS_NAMED_MEMBER_NAME, JSONCONS_GETTER_CTOR_NAMED_WRITE, ,0, ValueType, __VA_ARGS__) \
   /**/
  
 #define JSONCONS_TPL_GETTER_CTOR_NAMED_TRAITS_DECL(NumTemplateParams, ValueType, ...)  \
 JSONCONS_GETTER_CTOR_NAMED_TRAITS_DECL_BASE(NumTemplateParams, ValueType, __VA_ARGS__) \
+JSONCONS_GETTER_CTOR_SER_TRAITS_DECL_BASE(JSONCONS_NAMED_MEMBER_INDEX, JSONCONS_GETTER_CTOR_NAMED_SLOT, JSONCONS_GETTER_CTOR_NAMED_READ, JSONCONS_NAMED_MEMBER_REQUIRED, JSONCONS_GETTER_CTOR_NAMED_ARG, JSONCONS_NAMED_MEMBER_NAME, JSONCONS_GETTER_CTOR_NAMED_WRITE, ,NumTemplateParams, ValueType, __VA_ARGS__) \
   /**/
  
 #define JSONCONS_GETTER_SETTER_IS(Prefix, Seq) JSONCONS_EXPAND(JSONCONS_GETTER_SETTER_IS_ Seq)
@@ -629,18 +965,22 @@ namespace jsoncons \
  
 #define JSONCONS_GETTER_SETTER_NAMED_TRAITS_DECL(ValueType, ...)  \
 JSONCONS_GETTER_SETTER_NAMED_TRAITS_DECL_BASE(JSONCONS_GETTER_SETTER_NAMED_AS, 0, ValueType, __VA_ARGS__) \
+JSONCONS_MEMBER_SER_TRAITS_DECL_BASE(JSONCONS_GETTER_SETTER_INDEX, JSONCONS_GETTER_SETTER_READ, JSONCONS_GETTER_SETTER_NOT_REQUIRED, JSONCONS_GETTER_SETTER_RESET, JSONCONS_GETTER_SETTER_NAME, JSONCONS_GETTER_SETTER_WRITE, ,0, ValueType, __VA_ARGS__) \
   /**/
  
 #define JSONCONS_TPL_GETTER_SETTER_NAMED_TRAITS_DECL(NumTemplateParams, ValueType, ...)  \
 JSONCONS_GETTER_SETTER_NAMED_TRAITS_DECL_BASE(JSONCONS_GETTER_SETTER_NAMED_AS, NumTemplateParams, ValueType, __VA_ARGS__) \
+JSONCONS_MEMBER_SER_TRAITS_DECL_BASE(JSONCONS_GETTER_SETTER_INDEX, JSONCONS_GETTER_SETTER_READ, JSONCONS_GETTER_SETTER_NOT_REQUIRED, JSONCONS_GETTER_SETTER_RESET, JSONCONS_GETTER_SETTER_NAME, JSONCONS_GETTER_SETTER_WRITE, ,NumTemplateParams, ValueType, __VA_ARGS__) \
   /**/
  
 #define JSONCONS_STRICT_GETTER_SETTER_NAMED_TRAITS_DECL(ValueType, ...)  \
 JSONCONS_GETTER_SETTER_NAMED_TRAITS_DECL_BASE(JSONCONS_STRICT_GETTER_SETTER_NAMED_AS, 0, ValueType, __VA_ARGS__) \
+JSONCONS_MEMBER_SER_TRAITS_DECL_BASE(JSONCONS_GETTER_SETTER_INDEX, JSONCONS_GETTER_SETTER_READ, JSONCONS_GETTER_SETTER_REQUIRED, JSONCONS_GETTER_SETTER_RESET, JSONCONS_GETTER_SETTER_NAME, JSONCONS_GETTER_SETTER_WRITE, ,0, ValueType, __VA_ARGS__) \
   /**/
  
 #define JSONCONS_STRICT_TPL_GETTER_SETTER_NAMED_TRAITS_DECL(NumTemplateParams, ValueType, ...)  \
 JSONCONS_GETTER_SETTER_NAMED_TRAITS_DECL_BASE(JSONCONS_STRICT_GETTER_SETTER_NAMED_AS, NumTemplateParams, ValueType, __VA_ARGS__) \
+JSONCONS_MEMBER_SER_TRAITS_DECL_BASE(JSONCONS_GETTER_SETTER_INDEX, JSONCONS_GETTER_SETTER_READ, JSONCONS_GETTER_SETTER_REQUIRED, JSONCONS_GETTER_SETTER_RESET, JSONCONS_GETTER_SETTER_NAME, JSONCONS_GETTER_SETTER_WRITE, ,NumTemplateParams, ValueType, __VA_ARGS__) \
   /**/
 
 
@@ -0,0 +1,888 @@
+// Copyright 2019 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_LAZY_JSON_HPP
+#define JSONCONS_LAZY_JSON_HPP
+
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <type_traits> // std::enable_if
+#include <vector>
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/unicode_traits.hpp>
+#include <jsoncons/detail/decimal_to_double.hpp>
+#include <jsoncons/detail/parse_number.hpp>
+#include <jsoncons/detail/structural_index.hpp>
+#include <jsoncons/detail/json_view_base.hpp>
+
+namespace jsoncons {
+
+template <class CharT>
+class basic_lazy_json_document;
+
+template <class CharT>
+class basic_lazy_json_member;
+
+// basic_lazy_json
+
+// A read-only handle to a value in a basic_lazy_json_document. Values are
+// converted from the text when they are accessed, and subtrees that are not
+// accessed are skipped.
+
+template <class CharT>
+class basic_lazy_json
+    : public jsoncons::detail::json_view_base<basic_lazy_json<CharT>,CharT,basic_lazy_json_member<CharT>>
+{
+    typedef jsoncons::detail::json_view_base<basic_lazy_json<CharT>,CharT,basic_lazy_json_member<CharT>> base_type;
+public:
+    typedef CharT char_type;
+    typedef std::basic_string<CharT> string_type;
+    typedef basic_string_view<CharT> string_view_type;
+    typedef basic_lazy_json_document<CharT> document_type;
+    typedef basic_lazy_json_member<CharT> member_type;
+    typedef typename base_type::array_iterator array_iterator;
+    typedef typename base_type::object_iterator object_iterator;
+
+    using base_type::at;
+private:
+    friend class basic_lazy_json_document<CharT>;
+    friend class jsoncons::detail::json_view_base<basic_lazy_json<CharT>,CharT,basic_lazy_json_member<CharT>>;
+
+    const document_type* doc_;
+    size_t index_;
+
+    basic_lazy_json(const document_type* doc, size_t index)
+        : doc_(doc), index_(index)
+    {
+    }
+public:
+    // The text of the value, including the quotes of a string
+    string_view_type text() const
+    {
+        return doc_->token_text(index_);
+    }
+
+    bool is_null() const
+    {
+        return first_char() == 'n';
+    }
+
+    bool is_bool() const
+    {
+        return first_char() == 't' || first_char() == 'f';
+    }
+
+    bool is_string() const
+    {
+        return first_char() == '\"';
+    }
+
+    bool is_number() const
+    {
+        return first_char() == '-' || (first_char() >= '0' && first_char() <= '9');
+    }
+
+    bool is_int64() const
+    {
+        string_view_type s = text();
+        return is_number() && jsoncons::detail::is_integer(s.data(), s.length()) &&
+               jsoncons::detail::to_integer<int64_t>(s.data(), s.length()).ec == jsoncons::detail::to_integer_errc();
+    }
+
+    bool is_uint64() const
+    {
+        string_view_type s = text();
+        return is_number() && jsoncons::detail::is_uinteger(s.data(), s.length()) &&
+               jsoncons::detail::to_integer<uint64_t>(s.data(), s.length()).ec == jsoncons::detail::to_integer_errc();
+    }
+
+    bool is_double() const
+    {
+        return is_number() && !is_int64() && !is_uint64();
+    }
+
+    bool is_array() const
+    {
+        return first_char() == '[';
+    }
+
+    bool is_object() const
+    {
+        return first_char() == '{';
+    }
+
+    bool empty() const
+    {
+        switch (first_char())
+        {
+            case '[':
+            case '{':
+                return doc_->is_empty_container(index_);
+            case '\"':
+                return text().length() == 2;
+            default:
+                return false;
+        }
+    }
+
+    // The number of elements or members, counted by skipping over each one
+    size_t size() const
+    {
+        size_t count = 0;
+        if (is_array() || is_object())
+        {
+            const size_t step = is_object() ? 1 : 0;
+            const size_t end = doc_->match(index_);
+            for (size_t i = index_ + 1; i != end; i = doc_->next_sibling(i + step))
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    basic_lazy_json at(size_t i) const
+    {
+        if (!is_array())
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Index on non-array value not supported"));
+        }
+        const size_t end = doc_->match(index_);
+        size_t index = index_ + 1;
+        for (; index != end && i > 0; --i)
+        {
+            index = doc_->next_sibling(index);
+        }
+        if (index == end)
+        {
+            JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+        }
+        return basic_lazy_json(doc_, index);
+    }
+
+    bool as_bool() const
+    {
+        switch (first_char())
+        {
+            case 't':
+                return true;
+            case 'f':
+                return false;
+            default:
+                return to_json().as_bool();
+        }
+    }
+
+    double as_double() const
+    {
+        if (is_number())
+        {
+            string_view_type s = text();
+            auto result = jsoncons::detail::decimal_to_double(s.data(), s.length());
+            if (result.valid)
+            {
+                return result.value;
+            }
+        }
+        return to_json().as_double();
+    }
+
+    template <class T>
+    T as_integer() const
+    {
+        if (is_number())
+        {
+            string_view_type s = text();
+            if (std::is_signed<T>::value ? jsoncons::detail::is_integer(s.data(), s.length())
+                                         : jsoncons::detail::is_uinteger(s.data(), s.length()))
+            {
+                auto result = jsoncons::detail::to_integer<T>(s.data(), s.length());
+                if (result.ec == jsoncons::detail::to_integer_errc())
+                {
+                    return result.value;
+                }
+            }
+        }
+        return to_json().template as_integer<T>();
+    }
+
+    // A string without escapes is returned as a view of the input text
+    string_view_type as_string_view() const
+    {
+        if (!is_string())
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Not a string"));
+        }
+        if (doc_->is_escaped(index_))
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("String has escapes, use as_string"));
+        }
+        string_view_type s = text();
+        return string_view_type(s.data() + 1, s.length() - 2);
+    }
+
+    string_type as_string() const
+    {
+        if (is_string() && !doc_->is_escaped(index_))
+        {
+            string_view_type s = as_string_view();
+            return string_type(s.data(), s.length());
+        }
+        return to_json().as_string();
+    }
+
+    // Parses this value into a Json
+    template <class Json = basic_json<CharT>>
+    Json to_json() const
+    {
+        return doc_->template parse_token<Json>(index_);
+    }
+
+private:
+    CharT first_char() const
+    {
+        return doc_->first_char(index_);
+    }
+
+    // Elements are identified by their token index, members by the token index of their key
+
+    void element_positions(size_t& first, size_t& last) const
+    {
+        first = index_ + 1;
+        last = doc_->match(index_);
+    }
+
+    void member_positions(size_t& first, size_t& last) const
+    {
+        first = index_ + 1;
+        last = doc_->match(index_);
+    }
+
+    basic_lazy_json element_at(size_t index) const
+    {
+        return basic_lazy_json(doc_, index);
+    }
+
+    size_t next_element(size_t index) const
+    {
+        return doc_->next_sibling(index);
+    }
+
+    member_type member_at(size_t index) const
+    {
+        return member_type(basic_lazy_json(doc_, index), basic_lazy_json(doc_, index + 1));
+    }
+
+    size_t next_member(size_t index) const
+    {
+        return doc_->next_sibling(index + 1);
+    }
+
+    bool find_member(const string_view_type& name, size_t& index) const
+    {
+        const size_t end = doc_->match(index_);
+        for (size_t i = index_ + 1; i != end; i = doc_->next_sibling(i + 1))
+        {
+            if (doc_->key_equals(i, name))
+            {
+                index = i + 1;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+// basic_lazy_json_member
+
+template <class CharT>
+class basic_lazy_json_member
+{
+public:
+    typedef std::basic_string<CharT> string_type;
+private:
+    basic_lazy_json<CharT> key_;
+    basic_lazy_json<CharT> value_;
+public:
+    basic_lazy_json_member(const basic_lazy_json<CharT>& key, const basic_lazy_json<CharT>& value)
+        : key_(key), value_(value)
+    {
+    }
+
+    string_type key() const
+    {
+        return key_.as_string();
+    }
+
+    const basic_lazy_json<CharT>& value() const
+    {
+        return value_;
+    }
+};
+
+// basic_lazy_json_document
+
+// Indexes JSON text once, recording where each value begins and ends and where
+// each array and object closes, and gives access to the values through
+// basic_lazy_json handles. The text is not copied and must outlive the document
+// and its handles. Handles refer to the document, which is not movable.
+
+template <class CharT>
+class basic_lazy_json_document
+{
+public:
+    typedef CharT char_type;
+    typedef std::basic_string<CharT> string_type;
+    typedef basic_string_view<CharT> string_view_type;
+    typedef basic_lazy_json<CharT> value_type;
+private:
+    friend class basic_lazy_json<CharT>;
+
+    // For a scalar, extent is the offset one past its end, for an opening
+    // bracket the index of the closing one, and for a closing bracket the
+    // index of the opening one.
+    struct token
+    {
+        size_t offset;
+        size_t extent;
+        bool escaped;
+    };
+
+    enum class expect {value, value_or_end, name, name_or_end, colon, comma_or_end, done};
+
+    string_view_type input_;
+    jsoncons::detail::decode_options_copy<CharT> options_;
+    std::vector<token> tokens_;
+
+    // Noncopyable and nonmoveable, handles point to the document
+    basic_lazy_json_document(const basic_lazy_json_document&) = delete;
+    basic_lazy_json_document& operator=(const basic_lazy_json_document&) = delete;
+public:
+    explicit basic_lazy_json_document(const string_view_type& s,
+                                      const basic_json_decode_options<CharT>& options = basic_json_options<CharT>::get_default_options())
+        : input_(s), options_(options)
+    {
+        std::error_code ec;
+        size_t offset = 0;
+        build_index(ec, offset);
+        if (ec)
+        {
+            size_t line;
+            size_t column;
+            position_of(offset, line, column);
+            JSONCONS_THROW(ser_error(ec, line, column));
+        }
+    }
+
+    // The text must outlive the document
+    basic_lazy_json_document(string_type&&, const basic_json_decode_options<CharT>& = basic_json_options<CharT>::get_default_options()) = delete;
+
+    value_type root() const
+    {
+        return value_type(this, 0);
+    }
+
+    value_type at(const string_view_type& name) const
+    {
+        return root().at(name);
+    }
+
+    value_type operator[](const string_view_type& name) const
+    {
+        return root().at(name);
+    }
+
+    value_type at(size_t i) const
+    {
+        return root().at(i);
+    }
+
+    value_type operator[](size_t i) const
+    {
+        return root().at(i);
+    }
+
+    template <class T>
+    T as() const
+    {
+        return root().template as<T>();
+    }
+
+    // The number of entries in the structural index
+    size_t index_size() const
+    {
+        return tokens_.size();
+    }
+
+private:
+    CharT first_char(size_t index) const
+    {
+        return input_[tokens_[index].offset];
+    }
+
+    size_t match(size_t index) const
+    {
+        return tokens_[index].extent;
+    }
+
+    bool is_escaped(size_t index) const
+    {
+        return tokens_[index].escaped;
+    }
+
+    bool is_empty_container(size_t index) const
+    {
+        return tokens_[index].extent == index + 1;
+    }
+
+    size_t next_sibling(size_t index) const
+    {
+        const CharT c = first_char(index);
+        return (c == '[' || c == '{') ? tokens_[index].extent + 1 : index + 1;
+    }
+
+    string_view_type token_text(size_t index) const
+    {
+        const token& t = tokens_[index];
+        const CharT c = input_[t.offset];
+        const size_t end = (c == '[' || c == '{') ? tokens_[t.extent].offset + 1 : t.extent;
+        return string_view_type(input_.data() + t.offset, end - t.offset);
+    }
+
+    bool key_equals(size_t index, const string_view_type& name) const
+    {
+        if (!tokens_[index].escaped)
+        {
+            string_view_type s = token_text(index);
+            return s.length() == name.length() + 2 && string_view_type(s.data() + 1, s.length() - 2) == name;
+        }
+        return value_type(this, index).as_string() == name;
+    }
+
+    template <class Json>
+    Json parse_token(size_t index) const
+    {
+        string_view_type s = token_text(index);
+
+        json_decoder<Json> decoder;
+        basic_json_parser<CharT> parser(options_);
+        std::error_code ec;
+        parser.update(s.data(), s.length());
+        parser.parse_some(decoder, ec);
+        if (!ec)
+        {
+            parser.finish_parse(decoder, ec);
+        }
+        if (!ec)
+        {
+            parser.check_done(ec);
+        }
+        if (ec)
+        {
+            size_t line;
+            size_t column;
+            position_of(tokens_[index].offset, line, column);
+            if (parser.line() > 1)
+            {
+                line += parser.line() - 1;
+                column = parser.column();
+            }
+            else
+            {
+                column += parser.column() - 1;
+            }
+            JSONCONS_THROW(ser_error(ec, line, column));
+        }
+        return decoder.get_result();
+    }
+
+    // Line and column of an offset, only needed to report errors
+    void position_of(size_t offset, size_t& line, size_t& column) const
+    {
+        line = 1;
+        column = 1;
+        for (size_t i = 0; i < offset && i < input_.length(); ++i)
+        {
+            if (input_[i] == '\n' || (input_[i] == '\r' && (i+1 == input_.length() || input_[i+1] != '\n')))
+            {
+                ++line;
+                column = 1;
+            }
+            else if (input_[i] != '\n')
+            {
+                ++column;
+            }
+        }
+    }
+
+    // Checks the structure of the text with its own state machine rather than basic_json_parser,
+    // which only parses the tokens that are accessed. Changes to the grammar accepted by
+    // basic_json_parser must be made here as well.
+    void build_index(std::error_code& ec, size_t& offset)
+    {
+        auto bom = unicons::skip_bom(input_.begin(), input_.end());
+        if (bom.ec != unicons::encoding_errc())
+        {
+            ec = bom.ec;
+            return;
+        }
+
+        const CharT* first = input_.data();
+        const CharT* last = first + input_.length();
+        const CharT* p = first + (bom.it - input_.begin());
+
+        std::vector<size_t> stack;
+        expect state = expect::value;
+
+        while (true)
+        {
+            p = skip_whitespace(p, last, ec);
+            if (ec || p == last)
+            {
+                break;
+            }
+            offset = p - first;
+            const CharT c = *p;
+            if (state == expect::done)
+            {
+                ec = json_errc::extra_character;
+                return;
+            }
+            switch (c)
+            {
+                case '{':
+                case '[':
+                    if (state != expect::value && state != expect::value_or_end)
+                    {
+                        ec = unexpected(state);
+                        return;
+                    }
+                    if (stack.size() >= static_cast<size_t>(options_.max_nesting_depth()))
+                    {
+                        ec = json_errc::max_depth_exceeded;
+                        return;
+                    }
+                    stack.push_back(tokens_.size());
+                    tokens_.push_back(token{offset, 0, false});
+                    state = c == '{' ? expect::name_or_end : expect::value_or_end;
+                    ++p;
+                    break;
+                case '}':
+                case ']':
+                {
+                    const bool is_object = !stack.empty() && input_[tokens_[stack.back()].offset] == '{';
+                    if (stack.empty() || is_object != (c == '}'))
+                    {
+                        ec = c == '}' ? json_errc::unexpected_right_brace : json_errc::unexpected_right_bracket;
+                        return;
+                    }
+                    if (state == expect::value || state == expect::name)
+                    {
+                        ec = json_errc::extra_comma;
+                        return;
+                    }
+                    if (state == expect::colon)
+                    {
+                        ec = json_errc::expected_colon;
+                        return;
+                    }
+                    const size_t open = stack.back();
+                    stack.pop_back();
+                    tokens_[open].extent = tokens_.size();
+                    tokens_.push_back(token{offset, open, false});
+                    state = stack.empty() ? expect::done : expect::comma_or_end;
+                    ++p;
+                    break;
+                }
+                case ',':
+                    if (state != expect::comma_or_end)
+                    {
+                        ec = unexpected(state);
+                        return;
+                    }
+                    state = input_[tokens_[stack.back()].offset] == '{' ? expect::name : expect::value;
+                    ++p;
+                    break;
+                case ':':
+                    if (state != expect::colon)
+                    {
+                        ec = unexpected(state);
+                        return;
+                    }
+                    state = expect::value;
+                    ++p;
+                    break;
+                case '\"':
+                {
+                    const bool is_name = state == expect::name || state == expect::name_or_end;
+                    if (!is_name && state != expect::value && state != expect::value_or_end)
+                    {
+                        ec = unexpected(state);
+                        return;
+                    }
+                    bool escaped = false;
+                    p = skip_string(p + 1, last, escaped, ec);
+                    if (ec)
+                    {
+                        offset = p - first;
+                        return;
+                    }
+                    tokens_.push_back(token{offset, static_cast<size_t>(p - first), escaped});
+                    state = is_name ? expect::colon : (stack.empty() ? expect::done : expect::comma_or_end);
+                    break;
+                }
+                default:
+                {
+                    if (state != expect::value && state != expect::value_or_end)
+                    {
+                        ec = (state == expect::name || state == expect::name_or_end) ? json_errc::expected_name : unexpected(state);
+                        return;
+                    }
+                    const CharT* end = scan_scalar(p, last, ec);
+                    if (ec)
+                    {
+                        offset = end - first;
+                        return;
+                    }
+                    tokens_.push_back(token{offset, static_cast<size_t>(end - first), false});
+                    state = stack.empty() ? expect::done : expect::comma_or_end;
+                    p = end;
+                    break;
+                }
+            }
+        }
+        if (!ec && state != expect::done)
+        {
+            offset = input_.length();
+            ec = json_errc::unexpected_eof;
+        }
+    }
+
+    static json_errc unexpected(expect state)
+    {
+        switch (state)
+        {
+            case expect::name:
+            case expect::name_or_end:
+                return json_errc::expected_name;
+            case expect::colon:
+                return json_errc::expected_colon;
+            default:
+                return json_errc::expected_value;
+        }
+    }
+
+    static const CharT* skip_whitespace(const CharT* p, const CharT* last, std::error_code& ec)
+    {
+        while (p != last)
+        {
+            switch (*p)
+            {
+                case ' ': case '\t': case '\r': case '\n':
+                    ++p;
+                    break;
+                case '/':
+                    if (last - p >= 2 && *(p+1) == '*')
+                    {
+                        p += 2;
+                        while (p < last && !(*p == '*' && p+1 < last && *(p+1) == '/'))
+                        {
+                            ++p;
+                        }
+                        if (p == last)
+                        {
+                            ec = json_errc::unexpected_eof;
+                            return p;
+                        }
+                        p += 2;
+                    }
+                    else if (last - p >= 2 && *(p+1) == '/')
+                    {
+                        while (p < last && *p != '\n' && *p != '\r')
+                        {
+                            ++p;
+                        }
+                    }
+                    else
+                    {
+                        ec = json_errc::illegal_comment;
+                        return p;
+                    }
+                    break;
+                default:
+                    return p;
+            }
+        }
+        return p;
+    }
+
+    // p points after the opening quote, returns a pointer after the closing quote
+    static const CharT* skip_string(const CharT* p, const CharT* last, bool& escaped, std::error_code& ec)
+    {
+        while (true)
+        {
+            p = jsoncons::detail::find_string_special(p, last);
+            if (p == last)
+            {
+                ec = json_errc::unexpected_eof;
+                return p;
+            }
+            switch (*p)
+            {
+                case '\"':
+                    return p + 1;
+                case '\\':
+                    escaped = true;
+                    if (last - p < 2)
+                    {
+                        ec = json_errc::unexpected_eof;
+                        return last;
+                    }
+                    p += 2;
+                    break;
+                default:
+                    ec = json_errc::illegal_control_character;
+                    return p;
+            }
+        }
+    }
+
+    // Checks a literal or a number, returns a pointer to the character after it
+    static const CharT* scan_scalar(const CharT* p, const CharT* last, std::error_code& ec)
+    {
+        switch (*p)
+        {
+            case 't':
+                return scan_literal(p, last, "true", 4, ec);
+            case 'f':
+                return scan_literal(p, last, "false", 5, ec);
+            case 'n':
+                return scan_literal(p, last, "null", 4, ec);
+            case '-':
+            case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
+                return scan_number(p, last, ec);
+            default:
+                ec = json_errc::expected_value;
+                return p;
+        }
+    }
+
+    static const CharT* scan_literal(const CharT* p, const CharT* last, const char* literal, size_t length, std::error_code& ec)
+    {
+        for (size_t i = 0; i < length; ++i, ++p)
+        {
+            if (p == last)
+            {
+                ec = json_errc::unexpected_eof;
+                return p;
+            }
+            if (*p != literal[i])
+            {
+                ec = json_errc::invalid_value;
+                return p;
+            }
+        }
+        if (p != last && !is_delimiter(*p))
+        {
+            ec = json_errc::invalid_value;
+        }
+        return p;
+    }
+
+    static const CharT* scan_number(const CharT* p, const CharT* last, std::error_code& ec)
+    {
+        if (*p == '-')
+        {
+            ++p;
+        }
+        if (p == last || !is_digit(*p))
+        {
+            ec = p == last ? json_errc::unexpected_eof : json_errc::invalid_number;
+            return p;
+        }
+        if (*p == '0')
+        {
+            ++p;
+            if (p != last && is_digit(*p))
+            {
+                ec = json_errc::leading_zero;
+                return p;
+            }
+        }
+        else
+        {
+            while (p != last && is_digit(*p))
+            {
+                ++p;
+            }
+        }
+        if (p != last && *p == '.')
+        {
+            ++p;
+            if (p == last || !is_digit(*p))
+            {
+                ec = p == last ? json_errc::unexpected_eof : json_errc::invalid_number;
+                return p;
+            }
+            while (p != last && is_digit(*p))
+            {
+                ++p;
+            }
+        }
+        if (p != last && (*p == 'e' || *p == 'E'))
+        {
+            ++p;
+            if (p != last && (*p == '+' || *p == '-'))
+            {
+                ++p;
+            }
+            if (p == last || !is_digit(*p))
+            {
+                ec = p == last ? json_errc::unexpected_eof : json_errc::invalid_number;
+                return p;
+            }
+            while (p != last && is_digit(*p))
+            {
+                ++p;
+            }
+        }
+        if (p != last && !is_delimiter(*p))
+        {
+            ec = json_errc::invalid_number;
+        }
+        return p;
+    }
+
+    static bool is_digit(CharT c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    static bool is_delimiter(CharT c)
+    {
+        switch (c)
+        {
+            case ' ': case '\t': case '\r': case '\n':
+            case ',': case ']': case '}': case ':': case '/':
+                return true;
+            default:
+                return false;
+        }
+    }
+};
+
+typedef basic_lazy_json_document<char> lazy_json_document;
+typedef basic_lazy_json_document<wchar_t> wlazy_json_document;
+typedef basic_lazy_json<char> lazy_json;
+typedef basic_lazy_json<wchar_t> wlazy_json;
+
+}
+
+#endif
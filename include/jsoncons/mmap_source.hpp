@@ -0,0 +1,409 @@
+// Copyright 2019 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_MMAP_SOURCE_HPP
+#define JSONCONS_MMAP_SOURCE_HPP
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <string>
+#include <system_error>
+#include <utility> // std::swap
+#include <type_traits> // std::enable_if
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/byte_string.hpp> // jsoncons::byte_traits
+
+#if defined(_WIN32)
+// Keep min/max macros and rarely used headers out of translation units that include jsoncons
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#define JSONCONS_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#define JSONCONS_UNDEF_NOMINMAX
+#endif
+#include <windows.h>
+#ifdef JSONCONS_UNDEF_WIN32_LEAN_AND_MEAN
+#undef WIN32_LEAN_AND_MEAN
+#undef JSONCONS_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#ifdef JSONCONS_UNDEF_NOMINMAX
+#undef NOMINMAX
+#undef JSONCONS_UNDEF_NOMINMAX
+#endif
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace jsoncons {
+
+namespace detail {
+
+// mapped_file
+
+// A read-only mapping of a whole file
+
+class mapped_file
+{
+    const uint8_t* data_;
+    size_t size_;
+    std::error_code ec_;
+#if defined(_WIN32)
+    HANDLE file_;
+    HANDLE mapping_;
+#endif
+
+    // Noncopyable
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+public:
+    // Files at least this long are mapped with a sequential access hint
+    static const size_t sequential_advice_threshold = 1024*1024;
+
+    mapped_file()
+        : data_(nullptr), size_(0)
+#if defined(_WIN32)
+        , file_(INVALID_HANDLE_VALUE), mapping_(nullptr)
+#endif
+    {
+    }
+
+    explicit mapped_file(const std::string& path)
+        : mapped_file()
+    {
+        open(path);
+    }
+
+    mapped_file(mapped_file&& other) noexcept
+        : mapped_file()
+    {
+        swap(other);
+    }
+
+    mapped_file& operator=(mapped_file&& other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~mapped_file()
+    {
+        close();
+    }
+
+    void swap(mapped_file& other) noexcept
+    {
+        std::swap(data_,other.data_);
+        std::swap(size_,other.size_);
+        std::swap(ec_,other.ec_);
+#if defined(_WIN32)
+        std::swap(file_,other.file_);
+        std::swap(mapping_,other.mapping_);
+#endif
+    }
+
+    const uint8_t* data() const
+    {
+        return data_;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    // The error from opening or mapping the file, if any
+    std::error_code error() const
+    {
+        return ec_;
+    }
+
+private:
+#if defined(_WIN32)
+    void open(const std::string& path)
+    {
+        file_ = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE)
+        {
+            ec_ = std::error_code(static_cast<int>(::GetLastError()), std::system_category());
+            return;
+        }
+        LARGE_INTEGER size;
+        if (!::GetFileSizeEx(file_, &size))
+        {
+            ec_ = std::error_code(static_cast<int>(::GetLastError()), std::system_category());
+            return;
+        }
+        size_ = static_cast<size_t>(size.QuadPart);
+        if (size_ == 0)
+        {
+            return;
+        }
+        mapping_ = ::CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping_ == nullptr)
+        {
+            ec_ = std::error_code(static_cast<int>(::GetLastError()), std::system_category());
+            size_ = 0;
+            return;
+        }
+        data_ = static_cast<const uint8_t*>(::MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        if (data_ == nullptr)
+        {
+            ec_ = std::error_code(static_cast<int>(::GetLastError()), std::system_category());
+            size_ = 0;
+        }
+    }
+
+    void close()
+    {
+        if (data_ != nullptr)
+        {
+            ::UnmapViewOfFile(data_);
+            data_ = nullptr;
+        }
+        if (mapping_ != nullptr)
+        {
+            ::CloseHandle(mapping_);
+            mapping_ = nullptr;
+        }
+        if (file_ != INVALID_HANDLE_VALUE)
+        {
+            ::CloseHandle(file_);
+            file_ = INVALID_HANDLE_VALUE;
+        }
+        size_ = 0;
+    }
+#else
+    void open(const std::string& path)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            ec_ = std::error_code(errno, std::system_category());
+            return;
+        }
+        struct stat st;
+        if (::fstat(fd, &st) == -1)
+        {
+            ec_ = std::error_code(errno, std::system_category());
+            ::close(fd);
+            return;
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        if (size_ == 0)
+        {
+            ::close(fd);
+            return;
+        }
+        void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED)
+        {
+            ec_ = std::error_code(errno, std::system_category());
+            size_ = 0;
+            return;
+        }
+        data_ = static_cast<const uint8_t*>(p);
+        if (size_ >= sequential_advice_threshold)
+        {
+            ::madvise(p, size_, MADV_SEQUENTIAL);
+        }
+    }
+
+    void close()
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(const_cast<uint8_t*>(data_), size_);
+            data_ = nullptr;
+        }
+        size_ = 0;
+    }
+#endif
+};
+
+}
+
+// basic_mmap_source
+
+// Maps a file read-only and reads from the mapping without an intermediate copy.
+// Use mmap_source with the text readers and binary_mmap_source with the binary readers.
+
+template <class CharT, class TraitsT = std::char_traits<CharT>>
+class basic_mmap_source
+{
+public:
+    typedef CharT value_type;
+    typedef TraitsT traits_type;
+private:
+    jsoncons::detail::mapped_file file_;
+    const value_type* data_;
+    const value_type* input_ptr_;
+    const value_type* input_end_;
+    bool eof_;
+
+    // Noncopyable
+    basic_mmap_source(const basic_mmap_source&) = delete;
+    basic_mmap_source& operator=(const basic_mmap_source&) = delete;
+public:
+    basic_mmap_source()
+        : data_(nullptr), input_ptr_(nullptr), input_end_(nullptr), eof_(true)
+    {
+    }
+
+    explicit basic_mmap_source(const std::string& path)
+        : file_(path),
+          data_(reinterpret_cast<const value_type*>(file_.data())),
+          input_ptr_(data_),
+          input_end_(data_ + file_.size()/sizeof(value_type)),
+          eof_(input_ptr_ == input_end_)
+    {
+    }
+
+    basic_mmap_source(basic_mmap_source&& other) noexcept
+        : data_(nullptr), input_ptr_(nullptr), input_end_(nullptr), eof_(true)
+    {
+        swap(other);
+    }
+
+    basic_mmap_source& operator=(basic_mmap_source&& other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    void swap(basic_mmap_source& other) noexcept
+    {
+        file_.swap(other.file_);
+        std::swap(data_,other.data_);
+        std::swap(input_ptr_,other.input_ptr_);
+        std::swap(input_end_,other.input_end_);
+        std::swap(eof_,other.eof_);
+    }
+
+    const value_type* data() const
+    {
+        return data_;
+    }
+
+    size_t size() const
+    {
+        return input_end_ - data_;
+    }
+
+    std::error_code error() const
+    {
+        return file_.error();
+    }
+
+    bool eof() const
+    {
+        return eof_;
+    }
+
+    bool is_error() const
+    {
+        return static_cast<bool>(file_.error());
+    }
+
+    size_t position() const
+    {
+        return (input_ptr_ - data_) + 1;
+    }
+
+    size_t get(value_type& c)
+    {
+        if (input_ptr_ < input_end_)
+        {
+            c = *input_ptr_++;
+            return 1;
+        }
+        else
+        {
+            eof_ = true;
+            input_ptr_ = input_end_;
+            return 0;
+        }
+    }
+
+    int get()
+    {
+        if (input_ptr_ < input_end_)
+        {
+            return *input_ptr_++;
+        }
+        else
+        {
+            eof_ = true;
+            input_ptr_ = input_end_;
+            return traits_type::eof();
+        }
+    }
+
+    void ignore(size_t count)
+    {
+        input_ptr_ += advance(count);
+    }
+
+    int peek()
+    {
+        return input_ptr_ < input_end_ ? *input_ptr_ : traits_type::eof();
+    }
+
+    size_t read(value_type* p, size_t length)
+    {
+        size_t len = advance(length);
+        std::memcpy(p, input_ptr_, len*sizeof(value_type));
+        input_ptr_ += len;
+        return len;
+    }
+
+    template <class OutputIt>
+    typename std::enable_if<!std::is_same<OutputIt,value_type*>::value,size_t>::type
+    read(OutputIt d_first, size_t count)
+    {
+        size_t len = advance(count);
+        for (size_t i = 0; i < len; ++i)
+        {
+            *d_first++ = *input_ptr_++;
+        }
+        return len;
+    }
+
+    size_t read_view(const value_type*& data, size_t length)
+    {
+        size_t len = advance(length);
+        data = input_ptr_;
+        input_ptr_ += len;
+        return len;
+    }
+
+private:
+    size_t advance(size_t length)
+    {
+        if ((size_t)(input_end_ - input_ptr_) < length)
+        {
+            eof_ = true;
+            return input_end_ - input_ptr_;
+        }
+        return length;
+    }
+};
+
+typedef basic_mmap_source<char> mmap_source;
+typedef basic_mmap_source<wchar_t> wmmap_source;
+typedef basic_mmap_source<uint8_t,byte_traits> binary_mmap_source;
+
+}
+
+#endif
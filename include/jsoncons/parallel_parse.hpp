@@ -0,0 +1,359 @@
+// Copyright 2019 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_PARALLEL_PARSE_HPP
+#define JSONCONS_PARALLEL_PARSE_HPP
+
+#include <cstddef>
+#include <exception> // std::exception_ptr
+#include <system_error>
+#include <thread>
+#include <utility> // std::move
+#include <vector>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_content_handler.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/unicode_traits.hpp>
+#include <jsoncons/detail/structural_index.hpp>
+
+namespace jsoncons {
+
+// basic_json_array_chunk
+
+// A run of consecutive elements of a top-level JSON array. The first chunk
+// includes the text before the opening bracket, the last chunk the closing
+// bracket and the text after it. line and column give the position of the
+// first character of text in the original document.
+
+template <class CharT>
+struct basic_json_array_chunk
+{
+    basic_string_view<CharT> text;
+    size_t line;
+    size_t column;
+    bool first;
+    bool last;
+};
+
+typedef basic_json_array_chunk<char> json_array_chunk;
+typedef basic_json_array_chunk<wchar_t> wjson_array_chunk;
+
+// Inputs shorter than this are not split when the number of chunks is left to parallel_parse
+constexpr size_t min_parallel_chunk_length = 1024*1024;
+
+namespace detail {
+
+// Whether the text at p, after whitespace, starts an array element
+template <class CharT>
+bool element_follows(const CharT* p, const CharT* last)
+{
+    while (p != last && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n'))
+    {
+        ++p;
+    }
+    return p != last && *p != ',' && *p != ']' && *p != '}' && *p != '/';
+}
+
+}
+
+// split_json_array
+
+// Scans s for commas that separate elements of a top-level array, and splits it
+// into at most max_chunks chunks of roughly equal length. Text that is not an
+// array is returned as a single chunk. A comma that is not between two elements
+// ends the splitting, so that the last chunk's parser reports the error.
+
+template <class CharT>
+std::vector<basic_json_array_chunk<CharT>> split_json_array(const basic_string_view<CharT>& s, size_t max_chunks)
+{
+    typedef basic_json_array_chunk<CharT> chunk_type;
+
+    auto bom = unicons::skip_bom(s.begin(), s.end());
+    if (bom.ec != unicons::encoding_errc())
+    {
+        JSONCONS_THROW(ser_error(bom.ec));
+    }
+
+    const CharT* first = s.data() + (bom.it - s.begin());
+    const CharT* last = s.data() + s.size();
+    const CharT* p = first;
+    size_t line = 1;
+    const CharT* line_begin = first;
+
+    std::vector<chunk_type> chunks;
+
+    while (p != last && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n'))
+    {
+        if (*p == '\n' || (*p == '\r' && (p+1 == last || *(p+1) != '\n')))
+        {
+            ++line;
+            line_begin = p + 1;
+        }
+        ++p;
+    }
+    if (max_chunks <= 1 || p == last || *p != '[')
+    {
+        chunks.push_back(chunk_type{basic_string_view<CharT>(first, last - first), 1, 1, true, true});
+        return chunks;
+    }
+    ++p;
+
+    const size_t chunk_length = (last - first) / max_chunks;
+    const CharT* chunk_begin = first;
+    size_t chunk_line = 1;
+    size_t chunk_column = 1;
+    const CharT* next_split = first + chunk_length;
+    size_t depth = 1;
+    CharT prev = '['; // last character outside whitespace and comments
+
+    while (p < last && depth > 0)
+    {
+        const CharT c = *p;
+        switch (c)
+        {
+            case '\"':
+                ++p;
+                while (p < last)
+                {
+                    p = jsoncons::detail::find_string_special(p, last);
+                    if (p == last)
+                    {
+                        break;
+                    }
+                    if (*p == '\"')
+                    {
+                        ++p;
+                        break;
+                    }
+                    if (*p == '\\')
+                    {
+                        p += (last - p >= 2) ? 2 : 1;
+                        continue;
+                    }
+                    if (*p == '\n' || (*p == '\r' && (p+1 == last || *(p+1) != '\n')))
+                    {
+                        ++line;
+                        line_begin = p + 1;
+                    }
+                    ++p;
+                }
+                break;
+            case '[':
+            case '{':
+                ++depth;
+                ++p;
+                break;
+            case ']':
+            case '}':
+                --depth;
+                ++p;
+                break;
+            case ',':
+                if (depth == 1 && p >= next_split && chunks.size() + 1 < max_chunks)
+                {
+                    if (prev == ',' || prev == '[' || !jsoncons::detail::element_follows(p + 1, last))
+                    {
+                        next_split = last;
+                        ++p;
+                        break;
+                    }
+                    chunks.push_back(chunk_type{basic_string_view<CharT>(chunk_begin, p - chunk_begin),
+                                                chunk_line, chunk_column, chunks.empty(), false});
+                    chunk_begin = p + 1;
+                    chunk_line = line;
+                    chunk_column = (chunk_begin - line_begin) + 1;
+                    next_split = p + chunk_length;
+                }
+                ++p;
+                break;
+            case '\r':
+                if (p+1 == last || *(p+1) != '\n')
+                {
+                    ++line;
+                    line_begin = p + 1;
+                }
+                ++p;
+                break;
+            case '\n':
+                ++line;
+                ++p;
+                line_begin = p;
+                break;
+            case '/':
+                if (last - p >= 2 && *(p+1) == '*')
+                {
+                    p += 2;
+                    while (p < last && !(*p == '*' && p+1 < last && *(p+1) == '/'))
+                    {
+                        if (*p == '\n' || (*p == '\r' && (p+1 == last || *(p+1) != '\n')))
+                        {
+                            ++line;
+                            line_begin = p + 1;
+                        }
+                        ++p;
+                    }
+                    p = (p < last) ? p + 2 : last;
+                }
+                else if (last - p >= 2 && *(p+1) == '/')
+                {
+                    while (p < last && *p != '\n' && *p != '\r')
+                    {
+                        ++p;
+                    }
+                }
+                else
+                {
+                    ++p;
+                }
+                break;
+            default:
+                ++p;
+                break;
+        }
+        if (c != ' ' && c != '\t' && c != '\r' && c != '\n' && c != '/')
+        {
+            prev = c;
+        }
+    }
+    chunks.push_back(chunk_type{basic_string_view<CharT>(chunk_begin, last - chunk_begin),
+                                chunk_line, chunk_column, chunks.empty(), true});
+    return chunks;
+}
+
+// parse_json_array_chunk
+
+// Parses the elements of a chunk as an array, reporting line and column
+// numbers relative to the original document.
+
+template <class CharT>
+void parse_json_array_chunk(const basic_json_array_chunk<CharT>& chunk,
+                            basic_json_content_handler<CharT>& handler,
+                            const basic_json_decode_options<CharT>& options = basic_json_options<CharT>::get_default_options())
+{
+    static const CharT begin_array[] = {'['};
+    static const CharT end_array[] = {']'};
+
+    basic_json_parser<CharT> parser(options);
+    if (!chunk.first)
+    {
+        parser.set_position(chunk.line, chunk.column - 1);
+        parser.update(begin_array, 1);
+        parser.parse_some(handler);
+    }
+    parser.update(chunk.text.data(), chunk.text.size());
+    parser.parse_some(handler);
+    if (!chunk.last)
+    {
+        parser.update(end_array, 1);
+        parser.parse_some(handler);
+    }
+    parser.finish_parse(handler);
+    parser.check_done();
+}
+
+// parallel_parse
+
+// Parses a top-level array in chunks on up to max_chunks threads, and joins
+// the partial arrays in document order. If max_chunks is 0, it is chosen from
+// the input length and the number of hardware threads.
+
+template <class Json>
+Json parallel_parse(const basic_string_view<typename Json::char_type>& s,
+                    const basic_json_decode_options<typename Json::char_type>& options,
+                    size_t max_chunks = 0)
+{
+    typedef typename Json::char_type char_type;
+
+    if (max_chunks == 0)
+    {
+        size_t num_threads = std::thread::hardware_concurrency();
+        max_chunks = s.size() / min_parallel_chunk_length;
+        if (num_threads > 0 && max_chunks > num_threads)
+        {
+            max_chunks = num_threads;
+        }
+    }
+    std::vector<basic_json_array_chunk<char_type>> chunks = split_json_array(s, max_chunks);
+
+    std::vector<Json> results(chunks.size());
+    std::vector<std::exception_ptr> errors(chunks.size());
+
+    auto parse_chunk = [&](size_t i)
+    {
+        JSONCONS_TRY
+        {
+            json_decoder<Json> decoder;
+            parse_json_array_chunk(chunks[i], decoder, options);
+            if (!decoder.is_valid())
+            {
+                JSONCONS_THROW(json_runtime_error<std::runtime_error>("Failed to parse json string"));
+            }
+            results[i] = decoder.get_result();
+        }
+        JSONCONS_CATCH(...)
+        {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(chunks.size());
+    for (size_t i = 1; i < chunks.size(); ++i)
+    {
+        JSONCONS_TRY
+        {
+            threads.emplace_back(parse_chunk, i);
+        }
+        JSONCONS_CATCH(const std::system_error&)
+        {
+            parse_chunk(i);
+        }
+    }
+    parse_chunk(0);
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    for (auto& e : errors)
+    {
+        if (e)
+        {
+            std::rethrow_exception(e);
+        }
+    }
+
+    if (results.size() == 1)
+    {
+        return std::move(results[0]);
+    }
+    size_t count = 0;
+    for (const auto& r : results)
+    {
+        count += r.size();
+    }
+    Json result = std::move(results[0]);
+    result.reserve(count);
+    for (size_t i = 1; i < results.size(); ++i)
+    {
+        for (auto& item : results[i].array_range())
+        {
+            result.push_back(std::move(item));
+        }
+    }
+    return result;
+}
+
+template <class Json>
+Json parallel_parse(const basic_string_view<typename Json::char_type>& s, size_t max_chunks = 0)
+{
+    return parallel_parse<Json>(s, basic_json_options<typename Json::char_type>::get_default_options(), max_chunks);
+}
+
+}
+
+#endif
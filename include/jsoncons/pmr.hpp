@@ -0,0 +1,183 @@
+// Copyright 2019 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_PMR_HPP
+#define JSONCONS_PMR_HPP
+
+#include <jsoncons/config/jsoncons_config.hpp>
+
+#if defined(JSONCONS_HAS_POLYMORPHIC_ALLOCATOR)
+
+#include <cstddef>
+#include <memory_resource>
+#include <new> // placement new
+#include <type_traits> // std::is_same
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/unicode_traits.hpp>
+
+namespace jsoncons { namespace pmr {
+
+// Allocates from a std::pmr::memory_resource. Unlike std::pmr::polymorphic_allocator,
+// it constructs objects without uses-allocator construction, since basic_json passes
+// its allocator to its members explicitly, and copies keep the memory resource.
+template <class T>
+class polymorphic_allocator
+{
+    std::pmr::memory_resource* resource_;
+
+    template <class U> friend class polymorphic_allocator;
+public:
+    typedef T value_type;
+
+    polymorphic_allocator() noexcept
+        : resource_(std::pmr::get_default_resource())
+    {
+    }
+
+    polymorphic_allocator(std::pmr::memory_resource* resource) noexcept
+        : resource_(resource)
+    {
+    }
+
+    template <class U>
+    polymorphic_allocator(const polymorphic_allocator<U>& other) noexcept
+        : resource_(other.resource_)
+    {
+    }
+
+    T* allocate(size_t n)
+    {
+        return static_cast<T*>(resource_->allocate(n*sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept
+    {
+        resource_->deallocate(p, n*sizeof(T), alignof(T));
+    }
+
+    std::pmr::memory_resource* resource() const noexcept
+    {
+        return resource_;
+    }
+
+    template <class U>
+    friend bool operator==(const polymorphic_allocator& lhs, const polymorphic_allocator<U>& rhs) noexcept
+    {
+        return lhs.resource_ == rhs.resource_ || *lhs.resource_ == *rhs.resource_;
+    }
+
+    template <class U>
+    friend bool operator!=(const polymorphic_allocator& lhs, const polymorphic_allocator<U>& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+
+template <class CharT,class ImplementationPolicy>
+using basic_json = jsoncons::basic_json<CharT,ImplementationPolicy,polymorphic_allocator<char>>;
+
+typedef basic_json<char,sorted_policy> json;
+typedef basic_json<wchar_t,sorted_policy> wjson;
+typedef basic_json<char,preserve_order_policy> ojson;
+typedef basic_json<wchar_t,preserve_order_policy> wojson;
+
+// A document whose values, and the decoder's working memory, are allocated from
+// a monotonic buffer resource. Clearing or destroying it releases that memory
+// at once, without destroying the values one by one.
+template <class Json>
+class basic_json_arena
+{
+public:
+    typedef Json value_type;
+    typedef typename Json::char_type char_type;
+    typedef typename Json::allocator_type allocator_type;
+    typedef typename Json::string_view_type string_view_type;
+
+    static_assert(std::is_same<allocator_type,polymorphic_allocator<char>>::value,
+                  "basic_json_arena requires a basic_json with jsoncons::pmr::polymorphic_allocator<char>");
+private:
+    std::pmr::monotonic_buffer_resource resource_;
+    // The root is constructed in storage_ and never destroyed
+    alignas(Json) unsigned char storage_[sizeof(Json)];
+    Json* root_;
+public:
+    explicit basic_json_arena(size_t initial_size = 4096,
+                              std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : resource_(initial_size > 0 ? initial_size : 1, upstream),
+          root_(::new(&storage_) Json(null_type()))
+    {
+    }
+
+    basic_json_arena(const basic_json_arena&) = delete;
+    basic_json_arena& operator=(const basic_json_arena&) = delete;
+
+    allocator_type get_allocator() const
+    {
+        return allocator_type(const_cast<std::pmr::monotonic_buffer_resource*>(&resource_));
+    }
+
+    // Replaces the document with the JSON text s
+    void parse(const string_view_type& s,
+               const basic_json_decode_options<char_type>& options = basic_json_options<char_type>::get_default_options())
+    {
+        clear();
+
+        auto result = unicons::skip_bom(s.begin(), s.end());
+        if (result.ec != unicons::encoding_errc())
+        {
+            JSONCONS_THROW(ser_error(result.ec));
+        }
+        size_t offset = result.it - s.begin();
+
+        allocator_type allocator(&resource_);
+        json_decoder<Json,allocator_type> decoder(allocator, allocator);
+        basic_json_parser<char_type> parser(options);
+        parser.update(s.data()+offset,s.size()-offset);
+        parser.parse_some(decoder);
+        parser.finish_parse(decoder);
+        parser.check_done();
+        if (!decoder.is_valid())
+        {
+            JSONCONS_THROW(json_runtime_error<std::runtime_error>("Failed to parse json string"));
+        }
+        root_ = ::new(&storage_) Json(decoder.get_result());
+    }
+
+    const Json& root() const
+    {
+        return *root_;
+    }
+
+    const Json& operator*() const
+    {
+        return *root_;
+    }
+
+    const Json* operator->() const
+    {
+        return root_;
+    }
+
+    // Releases all memory, leaving a null document
+    void clear()
+    {
+        root_ = ::new(&storage_) Json(null_type());
+        resource_.release();
+    }
+};
+
+typedef basic_json_arena<json> json_arena;
+typedef basic_json_arena<wjson> wjson_arena;
+typedef basic_json_arena<ojson> ojson_arena;
+typedef basic_json_arena<wojson> wojson_arena;
+
+}}
+
+#endif // defined(JSONCONS_HAS_POLYMORPHIC_ALLOCATOR)
+
+#endif
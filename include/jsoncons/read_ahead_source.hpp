@@ -0,0 +1,385 @@
+// Copyright 2019 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_READ_AHEAD_SOURCE_HPP
+#define JSONCONS_READ_AHEAD_SOURCE_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstring> // std::memcpy
+#include <deque>
+#include <exception> // std::exception_ptr
+#include <memory> // std::unique_ptr
+#include <mutex>
+#include <thread>
+#include <type_traits> // std::enable_if
+#include <utility> // std::move
+#include <vector>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/source.hpp>
+
+namespace jsoncons {
+
+// read_ahead_source
+
+// Adapts a source so that a background thread reads ahead into a ring of buffers
+// while the reader parses the current one. The thread starts on the first read.
+// An exception thrown by the adapted source is rethrown by the read that reaches it.
+
+template <class Src>
+class read_ahead_source
+{
+public:
+    typedef typename Src::value_type value_type;
+    typedef typename Src::traits_type traits_type;
+    typedef Src source_type;
+
+    static const size_t default_buffer_length = 65536;
+    static const size_t default_num_buffers = 2;
+private:
+    struct filled_buffer
+    {
+        size_t index;
+        size_t length;
+    };
+
+    // Shared with the reading thread, and stays put when the source is moved
+    struct shared_state
+    {
+        Src source;
+        size_t buffer_length;
+        std::vector<std::vector<value_type>> buffers;
+        std::mutex mutex;
+        std::condition_variable producer_cv;
+        std::condition_variable consumer_cv;
+        std::deque<size_t> free;
+        std::deque<filled_buffer> filled;
+        bool stop;
+        bool done;
+        bool source_error;
+        bool started;
+        std::exception_ptr exception;
+        std::thread thread;
+
+        template <class Source>
+        shared_state(Source&& src, size_t length, size_t num_buffers)
+            : source(std::forward<Source>(src)),
+              buffer_length(length),
+              buffers(num_buffers),
+              stop(false),
+              done(false),
+              source_error(false),
+              started(false)
+        {
+        }
+
+        ~shared_state()
+        {
+            if (started)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    stop = true;
+                }
+                producer_cv.notify_one();
+                thread.join();
+            }
+        }
+
+        void read_ahead()
+        {
+            while (true)
+            {
+                size_t index;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    producer_cv.wait(lock, [this]() -> bool {return stop || !free.empty();});
+                    if (stop)
+                    {
+                        return;
+                    }
+                    index = free.front();
+                    free.pop_front();
+                }
+
+                size_t length = 0;
+                bool end = true;
+                JSONCONS_TRY
+                {
+                    length = source.read(buffers[index].data(), buffer_length);
+                    end = length == 0 || source.eof() || source.is_error();
+                }
+                JSONCONS_CATCH(...)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        free.push_back(index);
+                        exception = std::current_exception();
+                        done = true;
+                    }
+                    consumer_cv.notify_one();
+                    return;
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (length > 0)
+                    {
+                        filled.push_back(filled_buffer{index, length});
+                    }
+                    else
+                    {
+                        free.push_back(index);
+                    }
+                    if (end)
+                    {
+                        done = true;
+                        source_error = source.is_error();
+                    }
+                }
+                consumer_cv.notify_one();
+                if (end)
+                {
+                    return;
+                }
+            }
+        }
+    };
+
+    std::unique_ptr<shared_state> state_;
+    const value_type* input_ptr_;
+    const value_type* input_end_;
+    size_t current_;
+    size_t position_;
+    bool eof_;
+    bool is_error_;
+
+    // Noncopyable
+    read_ahead_source(const read_ahead_source&) = delete;
+    read_ahead_source& operator=(const read_ahead_source&) = delete;
+public:
+    read_ahead_source()
+        : read_ahead_source(Src())
+    {
+    }
+
+    template <class Source,
+              class Enable=typename std::enable_if<!std::is_same<typename std::decay<Source>::type,read_ahead_source>::value>::type>
+    read_ahead_source(Source&& source,
+                      size_t buffer_length = default_buffer_length,
+                      size_t num_buffers = default_num_buffers)
+        : state_(new shared_state(std::forward<Source>(source),
+                                  buffer_length > 0 ? buffer_length : 1,
+                                  num_buffers > 1 ? num_buffers : 2)),
+          input_ptr_(nullptr),
+          input_end_(nullptr),
+          current_(state_->buffers.size()),
+          position_(0),
+          eof_(false),
+          is_error_(false)
+    {
+    }
+
+    read_ahead_source(read_ahead_source&& other) noexcept
+        : input_ptr_(nullptr), input_end_(nullptr), current_(0), position_(0), eof_(true), is_error_(false)
+    {
+        swap(other);
+    }
+
+    read_ahead_source& operator=(read_ahead_source&& other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    void swap(read_ahead_source& other) noexcept
+    {
+        std::swap(state_,other.state_);
+        std::swap(input_ptr_,other.input_ptr_);
+        std::swap(input_end_,other.input_end_);
+        std::swap(current_,other.current_);
+        std::swap(position_,other.position_);
+        std::swap(eof_,other.eof_);
+        std::swap(is_error_,other.is_error_);
+    }
+
+    bool eof() const
+    {
+        return eof_;
+    }
+
+    bool is_error() const
+    {
+        return is_error_;
+    }
+
+    size_t position() const
+    {
+        return position_ + 1;
+    }
+
+    size_t get(value_type& c)
+    {
+        if (input_ptr_ == input_end_ && !next_buffer())
+        {
+            return 0;
+        }
+        c = *input_ptr_++;
+        ++position_;
+        return 1;
+    }
+
+    int get()
+    {
+        if (input_ptr_ == input_end_ && !next_buffer())
+        {
+            return traits_type::eof();
+        }
+        ++position_;
+        return *input_ptr_++;
+    }
+
+    void ignore(size_t count)
+    {
+        while (count > 0)
+        {
+            if (input_ptr_ == input_end_ && !next_buffer())
+            {
+                return;
+            }
+            size_t len = advance(count);
+            input_ptr_ += len;
+            count -= len;
+        }
+    }
+
+    int peek()
+    {
+        if (input_ptr_ == input_end_ && !next_buffer())
+        {
+            return traits_type::eof();
+        }
+        return *input_ptr_;
+    }
+
+    size_t read(value_type* p, size_t length)
+    {
+        size_t count = 0;
+        while (count < length)
+        {
+            if (input_ptr_ == input_end_ && !next_buffer())
+            {
+                break;
+            }
+            size_t len = advance(length - count);
+            std::memcpy(p + count, input_ptr_, len*sizeof(value_type));
+            input_ptr_ += len;
+            count += len;
+        }
+        return count;
+    }
+
+    template <class OutputIt>
+    typename std::enable_if<!std::is_same<OutputIt,value_type*>::value,size_t>::type
+    read(OutputIt d_first, size_t length)
+    {
+        size_t count = 0;
+        while (count < length)
+        {
+            if (input_ptr_ == input_end_ && !next_buffer())
+            {
+                break;
+            }
+            size_t len = advance(length - count);
+            for (size_t i = 0; i < len; ++i)
+            {
+                *d_first++ = *input_ptr_++;
+            }
+            count += len;
+        }
+        return count;
+    }
+
+    // Points data at up to length characters of the current buffer, which remain valid
+    // until the next call that moves past the end of the buffer
+    size_t read_view(const value_type*& data, size_t length)
+    {
+        if (input_ptr_ == input_end_ && !next_buffer())
+        {
+            data = input_ptr_;
+            return 0;
+        }
+        size_t len = advance(length);
+        data = input_ptr_;
+        input_ptr_ += len;
+        return len;
+    }
+
+private:
+    size_t advance(size_t length)
+    {
+        size_t len = (size_t)(input_end_ - input_ptr_) < length ? (size_t)(input_end_ - input_ptr_) : length;
+        position_ += len;
+        return len;
+    }
+
+    // Returns the current buffer to the reading thread and waits for the next one
+    bool next_buffer()
+    {
+        if (eof_ || !state_)
+        {
+            eof_ = true;
+            return false;
+        }
+        shared_state& state = *state_;
+
+        std::unique_lock<std::mutex> lock(state.mutex);
+        if (!state.started)
+        {
+            for (size_t i = 0; i < state.buffers.size(); ++i)
+            {
+                state.buffers[i].resize(state.buffer_length);
+                state.free.push_back(i);
+            }
+            shared_state* p = state_.get();
+            state.thread = std::thread([p](){p->read_ahead();});
+            state.started = true;
+        }
+        if (current_ < state.buffers.size())
+        {
+            state.free.push_back(current_);
+            current_ = state.buffers.size();
+            state.producer_cv.notify_one();
+        }
+        state.consumer_cv.wait(lock, [&state]() -> bool {return !state.filled.empty() || state.done;});
+        if (state.filled.empty())
+        {
+            if (state.exception)
+            {
+                std::exception_ptr e = state.exception;
+                state.exception = nullptr;
+                eof_ = true;
+                is_error_ = true;
+                input_ptr_ = input_end_;
+                std::rethrow_exception(e);
+            }
+            eof_ = true;
+            is_error_ = state.source_error;
+            input_ptr_ = input_end_;
+            return false;
+        }
+        filled_buffer b = state.filled.front();
+        state.filled.pop_front();
+        current_ = b.index;
+        input_ptr_ = state.buffers[b.index].data();
+        input_end_ = input_ptr_ + b.length;
+        return true;
+    }
+};
+
+}
+
+#endif
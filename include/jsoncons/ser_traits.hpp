@@ -10,8 +10,12 @@
 #include <string>
 #include <tuple>
 #include <array>
+#include <vector>
 #include <memory>
+#include <initializer_list>
+#include <algorithm> // std::sort
 #include <type_traits> // std::enable_if
+#include <new> // placement new
 #include <jsoncons/json_content_handler.hpp>
 #include <jsoncons/json_decoder.hpp>
 #include <jsoncons/basic_json.hpp>
@@ -19,6 +23,7 @@
 #include <jsoncons/json_encoder.hpp>
 #include <jsoncons/json_type_traits.hpp>
 #include <jsoncons/staj_reader.hpp>
+#include <jsoncons/unicode_traits.hpp>
 
 namespace jsoncons {
 
@@ -37,6 +42,20 @@ T read_from(const Json& j, basic_staj_reader<CharT>& reader)
     return val;
 }
 
+template <class T, class CharT, class Json>
+void read_into(const Json& j, basic_staj_reader<CharT>& reader, T& val, std::error_code& ec);
+
+template <class T, class CharT, class Json>
+void read_into(const Json& j, basic_staj_reader<CharT>& reader, T& val)
+{
+    std::error_code ec;
+    read_into(j, reader, val, ec);
+    if (ec)
+    {
+        JSONCONS_THROW(ser_error(ec, reader.context().line(), reader.context().column()));
+    }
+}
+
 template <class T, class CharT, class Json>
 void write_to(const T&val, basic_json_content_handler<CharT>& receiver);
 
@@ -46,27 +65,402 @@ void write_to(const T&val, basic_json_content_handler<CharT>& receiver);
 
 namespace jsoncons {
 
-template <class T, class Enable = void>
+namespace detail {
+
+    template <class T, class CharT, class Json>
+    T decode_through_json(basic_staj_reader<CharT>& reader, std::error_code& ec)
+    {
+        json_decoder<Json> decoder;
+        reader.read_to(decoder, ec);
+        return decoder.get_result().template as<T>();
+    }
+
+    template <class T, class CharT, class Json>
+    void encode_through_json(const T& val, basic_json_content_handler<CharT>& receiver)
+    {
+        auto j = json_type_traits<Json, T>::to_json(val);
+        j.dump(receiver);
+    }
+
+    // Compares a name read from a staj_reader with a member name literal, 
+    // which need not have the same character type
+    template <class CharT, class LitCharT>
+    bool name_equals(const basic_string_view<CharT>& name, const LitCharT* lit)
+    {
+        typedef typename std::make_unsigned<CharT>::type uchar_type;
+        typedef typename std::make_unsigned<LitCharT>::type ulit_type;
+
+        size_t i = 0;
+        for (; i < name.size(); ++i)
+        {
+            if (lit[i] == 0 || static_cast<uint32_t>(static_cast<uchar_type>(name[i])) != static_cast<uint32_t>(static_cast<ulit_type>(lit[i])))
+            {
+                return false;
+            }
+        }
+        return lit[i] == 0;
+    }
+
+    // FNV-1a over the code units of a name. literal_hash is constexpr, so that the generated 
+    // ser_traits can switch on the hashes of the member names
+    template <class LitCharT>
+    constexpr uint32_t literal_hash(const LitCharT* lit, uint32_t h = 2166136261u)
+    {
+        return *lit == 0 ? h : literal_hash(lit+1, (h ^ static_cast<uint32_t>(static_cast<typename std::make_unsigned<LitCharT>::type>(*lit))) * 16777619u);
+    }
+
+    template <class CharT>
+    uint32_t name_hash(const basic_string_view<CharT>& name)
+    {
+        typedef typename std::make_unsigned<CharT>::type uchar_type;
+
+        uint32_t h = 2166136261u;
+        for (auto c : name)
+        {
+            h = (h ^ static_cast<uint32_t>(static_cast<uchar_type>(c))) * 16777619u;
+        }
+        return h;
+    }
+
+    template <class CharT>
+    void encode_name(basic_json_content_handler<CharT>& receiver, const CharT* lit)
+    {
+        receiver.name(basic_string_view<CharT>(lit));
+    }
+
+    template <class CharT, class LitCharT>
+    typename std::enable_if<!std::is_same<CharT,LitCharT>::value>::type
+    encode_name(basic_json_content_handler<CharT>& receiver, const LitCharT* lit)
+    {
+        std::basic_string<CharT> buffer;
+        unicons::convert(lit, lit+std::char_traits<LitCharT>::length(lit), std::back_inserter(buffer), unicons::conv_flags::strict);
+        receiver.name(buffer);
+    }
+
+    // The order in which a Json object holds members with the given names, listed in declaration 
+    // order: declaration order if Json preserves order, otherwise sorted by name
+    template <class CharT, class Json, size_t N, class LitCharT>
+    std::array<size_t,N> member_order(std::initializer_list<const LitCharT*> names)
+    {
+        std::array<size_t,N> order;
+        for (size_t i = 0; i < N; ++i)
+        {
+            order[i] = i;
+        }
+        if (!Json::implementation_policy::preserve_order)
+        {
+            std::vector<std::basic_string<CharT>> keys;
+            keys.reserve(N);
+            for (auto lit : names)
+            {
+                std::basic_string<CharT> key;
+                unicons::convert(lit, lit+std::char_traits<LitCharT>::length(lit), std::back_inserter(key), unicons::conv_flags::strict);
+                keys.push_back(std::move(key));
+            }
+            std::sort(order.begin(), order.end(), 
+                      [&](size_t a, size_t b) -> bool {return keys[a].compare(keys[b]) < 0;});
+        }
+        return order;
+    }
+
+    template <class CharT>
+    void encode_string(basic_json_content_handler<CharT>& receiver, const CharT* lit)
+    {
+        receiver.string_value(basic_string_view<CharT>(lit));
+    }
+
+    template <class CharT, class LitCharT>
+    typename std::enable_if<!std::is_same<CharT,LitCharT>::value>::type
+    encode_string(basic_json_content_handler<CharT>& receiver, const LitCharT* lit)
+    {
+        std::basic_string<CharT> buffer;
+        unicons::convert(lit, lit+std::char_traits<LitCharT>::length(lit), std::back_inserter(buffer), unicons::conv_flags::strict);
+        receiver.string_value(buffer);
+    }
+
+    template <class CharT>
+    void encode_scalar(bool val, basic_json_content_handler<CharT>& receiver)
+    {
+        receiver.bool_value(val);
+    }
+
+    template <class T, class CharT>
+    typename std::enable_if<is_integer_like<T>::value>::type
+    encode_scalar(T val, basic_json_content_handler<CharT>& receiver)
+    {
+        receiver.int64_value(val);
+    }
+
+    template <class T, class CharT>
+    typename std::enable_if<is_uinteger_like<T>::value>::type
+    encode_scalar(T val, basic_json_content_handler<CharT>& receiver)
+    {
+        receiver.uint64_value(val);
+    }
+
+    template <class T, class CharT>
+    typename std::enable_if<std::is_floating_point<T>::value>::type
+    encode_scalar(T val, basic_json_content_handler<CharT>& receiver)
+    {
+        receiver.double_value(val);
+    }
+
+    template <class LitCharT>
+    void throw_key_not_found(const LitCharT* lit)
+    {
+        JSONCONS_THROW(key_not_found(lit, std::char_traits<LitCharT>::length(lit)));
+    }
+
+    // Leaves the reader on the last event of the current value
+    template <class CharT>
+    void skip_value(basic_staj_reader<CharT>& reader, std::error_code& ec)
+    {
+        size_t depth = 0;
+        do
+        {
+            switch (reader.current().event_type())
+            {
+                case staj_event_type::begin_array:
+                case staj_event_type::begin_object:
+                    ++depth;
+                    break;
+                case staj_event_type::end_array:
+                case staj_event_type::end_object:
+                    --depth;
+                    break;
+                default:
+                    break;
+            }
+            if (depth > 0)
+            {
+                reader.next(ec);
+            }
+        }
+        while (depth > 0 && !ec && !reader.done());
+    }
+
+    // Reads the members of an object, passing the id that member_index gives each name, 
+    // from 1 to 64, to read, and skipping members with id 0 and members whose id was already 
+    // read, so that of duplicate names the first is read. Returns a mask of the ids read. 
+    // A value that is not an object is skipped.
+    template <class CharT, class MemberIndex, class Read>
+    uint64_t read_members(basic_staj_reader<CharT>& reader, std::error_code& ec, 
+                          MemberIndex member_index, Read read)
+    {
+        uint64_t found = 0;
+        if (reader.current().event_type() != staj_event_type::begin_object)
+        {
+            skip_value(reader, ec);
+            return found;
+        }
+        reader.next(ec);
+        while (!ec && !reader.done() && reader.current().event_type() != staj_event_type::end_object)
+        {
+            // The name is only valid until the next event
+            const int id = member_index(reader.current().template get<basic_string_view<CharT>>());
+            reader.next(ec);
+            if (ec)
+            {
+                break;
+            }
+            if (id > 0 && !(found & (uint64_t(1) << (id-1))))
+            {
+                read(id);
+                found |= uint64_t(1) << (id-1);
+            }
+            else
+            {
+                skip_value(reader, ec);
+            }
+            if (ec)
+            {
+                break;
+            }
+            reader.next(ec);
+        }
+        return found;
+    }
+
+    // Holds a decoded member until all are read and the value can be constructed
+    template <class T>
+    class member_slot
+    {
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_;
+        T* valuep_;
+    public:
+        member_slot()
+            : valuep_(nullptr)
+        {
+        }
+
+        member_slot(const member_slot&) = delete;
+        member_slot& operator=(const member_slot&) = delete;
+
+        ~member_slot()
+        {
+            if (valuep_)
+            {
+                valuep_->~T();
+            }
+        }
+
+        void emplace(T&& val)
+        {
+            if (valuep_)
+            {
+                *valuep_ = std::move(val);
+            }
+            else
+            {
+                valuep_ = ::new(&storage_)T(std::move(val));
+            }
+        }
+
+        T& value()
+        {
+            return *valuep_;
+        }
+    };
+
+} // namespace detail
+
+template <class T, class Enable>
 struct ser_traits
 {
     template <class CharT, class Json>
     static T deserialize(basic_staj_reader<CharT>& reader, std::error_code& ec)
     {
-        json_decoder<Json> decoder;
-        reader.read_to(decoder, ec);
-        return decoder.get_result().template as<T>();
+        return jsoncons::detail::decode_through_json<T,CharT,Json>(reader, ec);
+    }
+
+    template <class CharT, class Json>
+    static void deserialize_into(basic_staj_reader<CharT>& reader, T& val, std::error_code& ec)
+    {
+        val = deserialize<CharT,Json>(reader, ec);
     }
 
     template <class CharT, class Json>
     static void serialize(const T& val, basic_json_content_handler<CharT>& receiver)
     {
-        auto j = json_type_traits<Json, T>::to_json(val);
-        j.dump(receiver);
+        jsoncons::detail::encode_through_json<T,CharT,Json>(val, receiver);
     }
 };
 
 // specializations
 
+// integer, floating point and bool
+
+template <class T>
+struct ser_traits<T,
+    typename std::enable_if<!is_json_type_traits_declared<T>::value && std::is_arithmetic<T>::value
+>::type>
+{
+    // Numbers and booleans are converted from the event, other values, e.g. strings, 
+    // are converted as they would be from a json value
+    template <class CharT, class Json>
+    static T deserialize(basic_staj_reader<CharT>& reader, std::error_code& ec)
+    {
+        switch (reader.current().event_type())
+        {
+            case staj_event_type::int64_value:
+            case staj_event_type::uint64_value:
+            case staj_event_type::double_value:
+            case staj_event_type::bool_value:
+                return reader.current().template get<T>();
+            default:
+                return jsoncons::detail::decode_through_json<T,CharT,Json>(reader, ec);
+        }
+    }
+
+    template <class CharT, class Json>
+    static void deserialize_into(basic_staj_reader<CharT>& reader, T& val, std::error_code& ec)
+    {
+        val = deserialize<CharT,Json>(reader, ec);
+    }
+
+    template <class CharT, class Json>
+    static void serialize(const T& val, basic_json_content_handler<CharT>& receiver)
+    {
+        jsoncons::detail::encode_scalar(val, receiver);
+    }
+};
+
+// string like
+
+template <class T>
+struct ser_traits<T,
+    typename std::enable_if<!is_json_type_traits_declared<T>::value && jsoncons::detail::is_string_like<T>::value
+>::type>
+{
+    template <class CharT, class Json>
+    static T deserialize(basic_staj_reader<CharT>& reader, std::error_code& ec)
+    {
+        return deserialize<CharT,Json>(reader, ec, std::is_same<typename T::value_type,CharT>());
+    }
+
+    template <class CharT, class Json>
+    static void deserialize_into(basic_staj_reader<CharT>& reader, T& val, std::error_code& ec)
+    {
+        deserialize_into<CharT,Json>(reader, val, ec, std::is_same<typename T::value_type,CharT>());
+    }
+
+    template <class CharT, class Json>
+    static void serialize(const T& val, basic_json_content_handler<CharT>& receiver)
+    {
+        serialize<CharT,Json>(val, receiver, std::is_same<typename T::value_type,CharT>());
+    }
+private:
+    template <class CharT, class Json>
+    static T deserialize(basic_staj_reader<CharT>& reader, std::error_code& ec, std::true_type)
+    {
+        if (reader.current().event_type() == staj_event_type::string_value)
+        {
+            auto sv = reader.current().template get<basic_string_view<CharT>>();
+            return T(sv.data(), sv.length());
+        }
+        return jsoncons::detail::decode_through_json<T,CharT,Json>(reader, ec);
+    }
+
+    template <class CharT, class Json>
+    static T deserialize(basic_staj_reader<CharT>& reader, std::error_code& ec, std::false_type)
+    {
+        return jsoncons::detail::decode_through_json<T,CharT,Json>(reader, ec);
+    }
+
+    // Reuses the capacity of val
+    template <class CharT, class Json>
+    static void deserialize_into(basic_staj_reader<CharT>& reader, T& val, std::error_code& ec, std::true_type)
+    {
+        if (reader.current().event_type() == staj_event_type::string_value)
+        {
+            auto sv = reader.current().template get<basic_string_view<CharT>>();
+            val.assign(sv.data(), sv.length());
+        }
+        else
+        {
+            val = jsoncons::detail::decode_through_json<T,CharT,Json>(reader, ec);
+        }
+    }
+
+    template <class CharT, class Json>
+    static void deserialize_into(basic_staj_reader<CharT>& reader, T& val, std::error_code& ec, std::false_type)
+    {
+        val = jsoncons::detail::decode_through_json<T,CharT,Json>(reader, ec);
+    }
+
+    template <class CharT, class Json>
+    static void serialize(const T& val, basic_json_content_handler<CharT>& receiver, std::true_type)
+    {
+        receiver.string_value(basic_string_view<CharT>(val.data(), val.size()));
+    }
+
+    template <class CharT, class Json>
+    static void serialize(const T& val, basic_json_content_handler<CharT>& receiver, std::false_type)
+    {
+        jsoncons::detail::encode_through_json<T,CharT,Json>(val, receiver);
+    }
+};
+
 // vector like
 
 template <class T>
@@ -80,15 +474,41 @@ struct ser_traits<T,
     static T deserialize(basic_staj_reader<CharT>& reader, std::error_code& ec)
     {
         T v;
-        staj_array_iterator<Json,value_type> end;
-        staj_array_iterator<Json,value_type> it(reader, ec);
+        deserialize_into<CharT,Json>(reader, v, ec);
+        return v;
+    }
 
-        while (it != end && !ec)
+    // Reads into the elements already in val, appends any more, and erases the rest.
+    // A value that is not an array is converted as it would be from a json value
+    template <class CharT, class Json>
+    static void deserialize_into(basic_staj_reader<CharT>& reader, T& val, std::error_code& ec)
+    {
+        if (reader.current().event_type() != staj_event_type::begin_array)
         {
-            v.push_back(*it);
-            it.increment(ec);
+            val = jsoncons::detail::decode_through_json<T,CharT,Json>(reader, ec);
+            return;
         }
-        return v;
+        auto it = val.begin();
+        reader.next(ec);
+        while (!ec && !reader.done() && reader.current().event_type() != staj_event_type::end_array)
+        {
+            if (it != val.end())
+            {
+                read_element_into<CharT,Json>(reader, *it, ec, std::is_same<typename T::reference,value_type&>());
+                ++it;
+            }
+            else
+            {
+                val.push_back(read_from<value_type>(Json(), reader, ec));
+                it = val.end();
+            }
+            if (ec)
+            {
+                break;
+            }
+            reader.next(ec);
+        }
+        val.erase(it, val.end());
     }
 
     template <class CharT, class Json>
@@ -102,6 +522,19 @@ struct ser_traits<T,
         receiver.end_array();
         receiver.flush();
     }
+private:
+    template <class CharT, class Json>
+    static void read_element_into(basic_staj_reader<CharT>& reader, value_type& element, std::error_code& ec, std::true_type)
+    {
+        read_into(Json(), reader, element, ec);
+    }
+
+    // e.g. std::vector<bool>
+    template <class CharT, class Json, class Reference>
+    static void read_element_into(basic_staj_reader<CharT>& reader, Reference element, std::error_code& ec, std::false_type)
+    {
+        element = read_from<value_type>(Json(), reader, ec);
+    }
 };
 
 // std::array
@@ -116,15 +549,43 @@ struct ser_traits<std::array<T,N>>
     {
         std::array<T,N> v;
         v.fill(T{});
-        staj_array_iterator<Json,value_type> end;
-        staj_array_iterator<Json,value_type> it(reader, ec);
+        deserialize_into<CharT,Json>(reader, v, ec);
+        return v;
+    }
 
-        for (size_t i = 0; it != end && i < N && !ec; ++i)
+    // Elements past N are skipped, and elements not read are set to T{}.
+    // A value that is not an array is converted as it would be from a json value
+    template <class CharT,class Json>
+    static void deserialize_into(basic_staj_reader<CharT>& reader, std::array<T,N>& val, std::error_code& ec)
+    {
+        if (reader.current().event_type() != staj_event_type::begin_array)
         {
-            v[i] = *it;
-            it.increment(ec);
+            val = jsoncons::detail::decode_through_json<std::array<T,N>,CharT,Json>(reader, ec);
+            return;
+        }
+        size_t i = 0;
+        reader.next(ec);
+        while (!ec && !reader.done() && reader.current().event_type() != staj_event_type::end_array)
+        {
+            if (i < N)
+            {
+                read_into(Json(), reader, val[i], ec);
+                ++i;
+            }
+            else
+            {
+                jsoncons::detail::skip_value(reader, ec);
+            }
+            if (ec)
+            {
+                break;
+            }
+            reader.next(ec);
+        }
+        for (; i < N; ++i)
+        {
+            val[i] = T{};
         }
-        return v;
     }
 
     template <class CharT, class Json>
@@ -155,15 +616,59 @@ struct ser_traits<T,
     static T deserialize(basic_staj_reader<CharT>& reader, std::error_code& ec)
     {
         T m;
-        staj_object_iterator<Json,mapped_type> end;
-        staj_object_iterator<Json,mapped_type> it(reader, ec);
+        deserialize_into<CharT,Json>(reader, m, ec);
+        return m;
+    }
 
-        while (it != end && !ec)
+    // Reads into the mapped values of keys already in val, inserts new keys, and erases
+    // the entries whose keys were not read. Of duplicate keys, the first is read.
+    // A value that is not an object is converted as it would be from a json value.
+    // The entries start out in unread, and each entry read is moved to val, so an entry 
+    // is marked as read by the map it is in, and those left in unread are erased with it
+    template <class CharT, class Json>
+    static void deserialize_into(basic_staj_reader<CharT>& reader, T& val, std::error_code& ec)
+    {
+        if (reader.current().event_type() != staj_event_type::begin_object)
         {
-            m.emplace(it->first,it->second);
-            it.increment(ec);
+            val = jsoncons::detail::decode_through_json<T,CharT,Json>(reader, ec);
+            return;
+        }
+        T unread;
+        unread.swap(val);
+
+        key_type key;
+        reader.next(ec);
+        while (!ec && !reader.done() && reader.current().event_type() != staj_event_type::end_object)
+        {
+            auto name = reader.current().template get<basic_string_view<CharT>>();
+            key.assign(name.data(), name.size());
+            reader.next(ec);
+            if (ec)
+            {
+                break;
+            }
+            if (val.find(key) != val.end())
+            {
+                jsoncons::detail::skip_value(reader, ec);
+            }
+            else
+            {
+                auto it = unread.find(key);
+                if (it != unread.end())
+                {
+                    read_entry_into<CharT,Json>(reader, unread, it, val, ec, jsoncons::detail::has_node_extract<T>());
+                }
+                else
+                {
+                    val.emplace(key, read_from<mapped_type>(Json(), reader, ec));
+                }
+            }
+            if (ec)
+            {
+                break;
+            }
+            reader.next(ec);
         }
-        return m;
     }
 
     template <class CharT, class Json>
@@ -178,6 +683,26 @@ struct ser_traits<T,
         receiver.end_object();
         receiver.flush();
     }
+private:
+    // Moves the node, so the entry keeps its memory, e.g. a std::map with C++17
+    template <class CharT, class Json>
+    static void read_entry_into(basic_staj_reader<CharT>& reader, T& unread, typename T::iterator it, T& val, 
+                                std::error_code& ec, std::true_type)
+    {
+        auto node = unread.extract(it);
+        read_into(Json(), reader, node.mapped(), ec);
+        val.insert(std::move(node));
+    }
+
+    // Moves the mapped value, so it keeps the memory it holds
+    template <class CharT, class Json>
+    static void read_entry_into(basic_staj_reader<CharT>& reader, T& unread, typename T::iterator it, T& val, 
+                                std::error_code& ec, std::false_type)
+    {
+        auto entry = val.emplace(it->first, std::move(it->second)).first;
+        unread.erase(it);
+        read_into(Json(), reader, entry->second, ec);
+    }
 };
 
 template <class T, class CharT, class Json>
@@ -186,6 +711,12 @@ T read_from(const Json&, basic_staj_reader<CharT>& reader, std::error_code& ec)
     return ser_traits<T>::template deserialize<CharT,Json>(reader,ec);
 }
 
+template <class T, class CharT, class Json>
+void read_into(const Json&, basic_staj_reader<CharT>& reader, T& val, std::error_code& ec)
+{
+    ser_traits<T>::template deserialize_into<CharT,Json>(reader, val, ec);
+}
+
 template <class T, class CharT, class Json>
 void write_to(const Json&, const T&val, basic_json_content_handler<CharT>& receiver)
 {
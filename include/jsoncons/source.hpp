@@ -15,6 +15,7 @@
 #include <cstring> // std::memcpy
 #include <exception>
 #include <type_traits> // std::enable_if
+#include <utility> // std::declval
 #include <jsoncons/config/jsoncons_config.hpp>
 #include <jsoncons/byte_string.hpp> // jsoncons::byte_traits
 
@@ -409,8 +410,38 @@ public:
         }
         return len;
     }
+
+    size_t read_view(const value_type*& data, size_t length)
+    {
+        size_t len;
+        if ((size_t)(input_end_ - input_ptr_) < length)
+        {
+            len = input_end_ - input_ptr_;
+            eof_ = true;
+        }
+        else
+        {
+            len = length;
+        }
+        data = input_ptr_;
+        input_ptr_ += len;
+        return len;
+    }
 };
 
+// is_contiguous_source
+
+// Sources that hold their input in memory provide read_view, which advances past up 
+// to length characters and points data at them, so that readers need not copy them
+
+template <class Src, class Enable=void>
+struct is_contiguous_source : std::false_type {};
+
+template <class Src>
+struct is_contiguous_source<Src,
+                            typename std::enable_if<std::is_same<decltype(std::declval<Src&>().read_view(std::declval<const typename Src::value_type*&>(),size_t())),size_t>::value>::type> 
+    : std::true_type {};
+
 // binary sources
 
 class binary_stream_source 
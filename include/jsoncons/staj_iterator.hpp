@@ -14,6 +14,7 @@
 #include <system_error>
 #include <ios>
 #include <iterator> // std::input_iterator_tag
+#include <type_traits> // std::is_nothrow_move_constructible
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/staj_reader.hpp>
 
@@ -79,11 +80,13 @@ public:
         }
     }
 
-    staj_array_iterator(staj_array_iterator&& other) noexcept
-        : reader_(nullptr), valuep_(nullptr)
+    staj_array_iterator(staj_array_iterator&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+        : reader_(other.reader_), valuep_(nullptr)
     {
-        std::swap(reader_,other.reader_);
-        std::swap(valuep_,other.valuep_);
+        if (other.valuep_)
+        {
+            valuep_ = ::new(&storage_)T(std::move(*other.valuep_));
+        }
     }
 
     ~staj_array_iterator()
@@ -96,23 +99,37 @@ public:
 
     staj_array_iterator& operator=(const staj_array_iterator& other)
     {
-        reader_ = other.reader_;
-        if (valuep_)
+        if (this != &other)
         {
-            valuep_->~T();
-            valuep_ = nullptr;
-        }
-        if (other.valuep_)
-        {
-            valuep_ = ::new(&storage_)T(*other.valuep_);
+            reader_ = other.reader_;
+            if (valuep_)
+            {
+                valuep_->~T();
+                valuep_ = nullptr;
+            }
+            if (other.valuep_)
+            {
+                valuep_ = ::new(&storage_)T(*other.valuep_);
+            }
         }
         return *this;
     }
 
-    staj_array_iterator& operator=(staj_array_iterator&& other) noexcept
+    staj_array_iterator& operator=(staj_array_iterator&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
     {
-        std::swap(reader_,other.reader_);
-        std::swap(valuep_,other.valuep_);
+        if (this != &other)
+        {
+            reader_ = other.reader_;
+            if (valuep_)
+            {
+                valuep_->~T();
+                valuep_ = nullptr;
+            }
+            if (other.valuep_)
+            {
+                valuep_ = ::new(&storage_)T(std::move(*other.valuep_));
+            }
+        }
         return *this;
     }
 
@@ -171,6 +188,10 @@ private:
     void next();
 
     void next(std::error_code& ec);
+
+    void read_value();
+
+    void read_value(std::error_code& ec);
 };
 
 template <class Json, class T>
@@ -248,7 +269,7 @@ public:
         }
     }
 
-    staj_object_iterator(staj_object_iterator&& other) noexcept
+    staj_object_iterator(staj_object_iterator&& other) noexcept(std::is_nothrow_move_constructible<value_type>::value)
         : reader_(other.reader_), kvp_(nullptr)
     {
         if (other.kvp_)
@@ -267,23 +288,37 @@ public:
 
     staj_object_iterator& operator=(const staj_object_iterator& other)
     {
-        reader_ = other.reader_;
-        if (kvp_)
-        {
-            kvp_->~T();
-            kvp_ = nullptr;
-        }
-        if (other.kvp_)
+        if (this != &other)
         {
-            kvp_ = ::new(&storage_)value_type(*other.kvp_);
+            reader_ = other.reader_;
+            if (kvp_)
+            {
+                kvp_->~value_type();
+                kvp_ = nullptr;
+            }
+            if (other.kvp_)
+            {
+                kvp_ = ::new(&storage_)value_type(*other.kvp_);
+            }
         }
         return *this;
     }
 
-    staj_object_iterator& operator=(staj_object_iterator&& other) noexcept
+    staj_object_iterator& operator=(staj_object_iterator&& other) noexcept(std::is_nothrow_move_constructible<value_type>::value)
     {
-        std::swap(reader_,other.reader_);
-        std::swap(kvp_,other.kvp_);
+        if (this != &other)
+        {
+            reader_ = other.reader_;
+            if (kvp_)
+            {
+                kvp_->~value_type();
+                kvp_ = nullptr;
+            }
+            if (other.kvp_)
+            {
+                kvp_ = ::new(&storage_)value_type(std::move(*other.kvp_));
+            }
+        }
         return *this;
     }
 
@@ -344,6 +379,9 @@ private:
 
     void next(std::error_code& ec);
 
+    void read_member();
+
+    void read_member(std::error_code& ec);
 };
 
 template<class Json, class T>
@@ -364,41 +402,57 @@ staj_object_iterator<Json,T> end(const staj_object_iterator<Json,T>&) noexcept
 
 namespace jsoncons {
 
+// After the first element, each element is read into the storage of the previous one.
+// The reader is on the last event of the previous element, which may be the end of an array, 
+// so it is advanced before checking for the end of this one
+
 template <class Json, class T>
 void staj_array_iterator<Json,T>::next()
 {
+    reader_->next();
     if (!done())
     {
-        reader_->next();
-        if (!done())
-        {
-            if (valuep_)
-            {
-                valuep_->~T();
-            }
-            valuep_ = ::new(&storage_)T(read_from<T>(Json(), *reader_));
-        }
+        read_value();
     }
 }
 
 template<class Json, class T>
 void staj_array_iterator<Json,T>::next(std::error_code& ec)
 {
+    reader_->next(ec);
+    if (ec)
+    {
+        return;
+    }
     if (!done())
     {
-        reader_->next(ec);
-        if (ec)
-        {
-            return;
-        }
-        if (!done())
-        {
-            if (valuep_)
-            {
-                valuep_->~T();
-            }
-            valuep_ = ::new(&storage_)T(read_from<T>(Json(), *reader_, ec));
-        }
+        read_value(ec);
+    }
+}
+
+template <class Json, class T>
+void staj_array_iterator<Json,T>::read_value()
+{
+    if (valuep_)
+    {
+        read_into(Json(), *reader_, *valuep_);
+    }
+    else
+    {
+        valuep_ = ::new(&storage_)T(read_from<T>(Json(), *reader_));
+    }
+}
+
+template <class Json, class T>
+void staj_array_iterator<Json,T>::read_value(std::error_code& ec)
+{
+    if (valuep_)
+    {
+        read_into(Json(), *reader_, *valuep_, ec);
+    }
+    else
+    {
+        valuep_ = ::new(&storage_)T(read_from<T>(Json(), *reader_, ec));
     }
 }
 
@@ -408,17 +462,7 @@ void staj_object_iterator<Json,T>::next()
     reader_->next();
     if (!done())
     {
-        JSONCONS_ASSERT(reader_->current().event_type() == staj_event_type::name);
-        key_type key = reader_->current(). template get<key_type>();
-        reader_->next();
-        if (!done())
-        {
-            if (kvp_)
-            {
-                kvp_->~value_type();
-            }
-            kvp_ = ::new(&storage_)value_type(std::move(key),read_from<T>(Json(), *reader_));
-        }
+        read_member();
     }
 }
 
@@ -432,19 +476,55 @@ void staj_object_iterator<Json,T>::next(std::error_code& ec)
     }
     if (!done())
     {
-        JSONCONS_ASSERT(reader_->current().event_type() == staj_event_type::name);
-        auto key = reader_->current(). template get<key_type>();
-        reader_->next(ec);
-        if (ec)
+        read_member(ec);
+    }
+}
+
+template<class Json, class T>
+void staj_object_iterator<Json,T>::read_member()
+{
+    JSONCONS_ASSERT(reader_->current().event_type() == staj_event_type::name);
+    auto name = reader_->current(). template get<basic_string_view<char_type>>();
+    if (kvp_)
+    {
+        kvp_->first.assign(name.data(), name.size());
+        reader_->next();
+        if (!done())
         {
-            return;
+            read_into(Json(), *reader_, kvp_->second);
         }
+    }
+    else
+    {
+        key_type key(name.data(), name.size());
+        reader_->next();
         if (!done())
         {
-            if (kvp_)
-            {
-                kvp_->~value_type();
-            }
+            kvp_ = ::new(&storage_)value_type(std::move(key),read_from<T>(Json(), *reader_));
+        }
+    }
+}
+
+template<class Json, class T>
+void staj_object_iterator<Json,T>::read_member(std::error_code& ec)
+{
+    JSONCONS_ASSERT(reader_->current().event_type() == staj_event_type::name);
+    auto name = reader_->current(). template get<basic_string_view<char_type>>();
+    if (kvp_)
+    {
+        kvp_->first.assign(name.data(), name.size());
+        reader_->next(ec);
+        if (!ec && !done())
+        {
+            read_into(Json(), *reader_, kvp_->second, ec);
+        }
+    }
+    else
+    {
+        key_type key(name.data(), name.size());
+        reader_->next(ec);
+        if (!ec && !done())
+        {
             kvp_ = ::new(&storage_)value_type(std::move(key),read_from<T>(Json(), *reader_, ec));
         }
     }
@@ -0,0 +1,243 @@
+// Copyright 2019 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_STRING_POOL_HPP
+#define JSONCONS_STRING_POOL_HPP
+
+#include <cstddef>
+#include <cstring> // std::memcpy
+#include <memory> // std::allocator, std::allocator_traits
+#include <vector>
+#include <utility> // std::move, std::swap
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/detail/hash.hpp>
+
+namespace jsoncons {
+
+// Stores one copy of each distinct string in blocks that are never moved or freed
+// before the pool is destroyed or cleared, so interned views stay valid. Not thread safe.
+template <class CharT, class Allocator = std::allocator<char>>
+class basic_string_pool
+{
+public:
+    typedef CharT char_type;
+    typedef Allocator allocator_type;
+    typedef basic_string_view<char_type> string_view_type;
+private:
+    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<char_type> char_allocator_type;
+
+    struct block
+    {
+        char_type* data;
+        size_t capacity;
+    };
+
+    struct entry
+    {
+        size_t hash;
+        const char_type* data;
+        size_t length;
+    };
+
+    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<block> block_allocator_type;
+    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<entry> entry_allocator_type;
+
+    char_allocator_type char_allocator_;
+    size_t block_size_;
+    std::vector<block,block_allocator_type> blocks_;
+    size_t block_used_;
+    std::vector<entry,entry_allocator_type> table_;
+    size_t size_;
+    size_t length_;
+    size_t lookups_;
+    size_t hits_;
+public:
+    explicit basic_string_pool(size_t block_size = 4096,
+                               const allocator_type& allocator = allocator_type())
+        : char_allocator_(allocator),
+          block_size_(block_size > 0 ? block_size : 1),
+          blocks_(block_allocator_type(allocator)),
+          block_used_(0),
+          table_(entry_allocator_type(allocator)),
+          size_(0),
+          length_(0),
+          lookups_(0),
+          hits_(0)
+    {
+    }
+
+    basic_string_pool(const basic_string_pool&) = delete;
+
+    basic_string_pool(basic_string_pool&& other) noexcept
+        : char_allocator_(other.char_allocator_),
+          block_size_(other.block_size_),
+          blocks_(std::move(other.blocks_)),
+          block_used_(other.block_used_),
+          table_(std::move(other.table_)),
+          size_(other.size_),
+          length_(other.length_),
+          lookups_(other.lookups_),
+          hits_(other.hits_)
+    {
+        other.blocks_.clear();
+        other.table_.clear();
+        other.block_used_ = 0;
+        other.size_ = 0;
+        other.length_ = 0;
+    }
+
+    ~basic_string_pool() noexcept
+    {
+        release();
+    }
+
+    basic_string_pool& operator=(const basic_string_pool&) = delete;
+
+    // Returns a view of the pooled copy of s, adding one if there is none
+    string_view_type intern(const string_view_type& s)
+    {
+        ++lookups_;
+        const size_t hash = jsoncons::detail::fnv1a_hash(s.data(), s.length());
+        if (!table_.empty())
+        {
+            const size_t mask = table_.size() - 1;
+            for (size_t i = hash & mask; table_[i].data != nullptr; i = (i + 1) & mask)
+            {
+                const entry& e = table_[i];
+                if (e.hash == hash && e.length == s.length() &&
+                    std::char_traits<char_type>::compare(e.data, s.data(), s.length()) == 0)
+                {
+                    ++hits_;
+                    return string_view_type(e.data, e.length);
+                }
+            }
+        }
+
+        if ((size_ + 1)*4 > table_.size()*3)
+        {
+            grow();
+        }
+        const char_type* p = store(s);
+        insert_entry(entry{hash, p, s.length()});
+        ++size_;
+        length_ += s.length();
+        return string_view_type(p, s.length());
+    }
+
+    // Number of distinct strings
+    size_t size() const
+    {
+        return size_;
+    }
+
+    // Total length of the distinct strings
+    size_t length() const
+    {
+        return length_;
+    }
+
+    size_t lookups() const
+    {
+        return lookups_;
+    }
+
+    size_t hits() const
+    {
+        return hits_;
+    }
+
+    double hit_rate() const
+    {
+        return lookups_ == 0 ? 0.0 : static_cast<double>(hits_)/static_cast<double>(lookups_);
+    }
+
+    void reset_statistics()
+    {
+        lookups_ = 0;
+        hits_ = 0;
+    }
+
+    // Invalidates all interned views
+    void clear()
+    {
+        release();
+        blocks_.clear();
+        table_.clear();
+        block_used_ = 0;
+        size_ = 0;
+        length_ = 0;
+        reset_statistics();
+    }
+private:
+    const char_type* store(const string_view_type& s)
+    {
+        const size_t n = s.length() + 1;
+        if (blocks_.empty() || block_used_ + n > blocks_.back().capacity)
+        {
+            const size_t capacity = n > block_size_ ? n : block_size_;
+            char_type* data = std::allocator_traits<char_allocator_type>::allocate(char_allocator_, capacity);
+            JSONCONS_TRY
+            {
+                blocks_.push_back(block{data, capacity});
+            }
+            JSONCONS_CATCH(...)
+            {
+                std::allocator_traits<char_allocator_type>::deallocate(char_allocator_, data, capacity);
+                JSONCONS_RETHROW;
+            }
+            block_used_ = 0;
+        }
+        char_type* p = blocks_.back().data + block_used_;
+        if (s.length() > 0)
+        {
+            std::memcpy(p, s.data(), s.length()*sizeof(char_type));
+        }
+        p[s.length()] = 0;
+        block_used_ += n;
+        return p;
+    }
+
+    void insert_entry(const entry& e)
+    {
+        const size_t mask = table_.size() - 1;
+        size_t i = e.hash & mask;
+        while (table_[i].data != nullptr)
+        {
+            i = (i + 1) & mask;
+        }
+        table_[i] = e;
+    }
+
+    void grow()
+    {
+        std::vector<entry,entry_allocator_type> old(table_.empty() ? 64 : table_.size()*2,
+                                                    entry{0,nullptr,0},
+                                                    table_.get_allocator());
+        table_.swap(old);
+        for (const auto& e : old)
+        {
+            if (e.data != nullptr)
+            {
+                insert_entry(e);
+            }
+        }
+    }
+
+    void release() noexcept
+    {
+        for (auto& b : blocks_)
+        {
+            std::allocator_traits<char_allocator_type>::deallocate(char_allocator_, b.data, b.capacity);
+        }
+    }
+};
+
+typedef basic_string_pool<char> string_pool;
+typedef basic_string_pool<wchar_t> wstring_pool;
+
+}
+
+#endif
@@ -16,6 +16,7 @@
 #include <jsoncons/config/binary_config.hpp>
 #include <jsoncons_ext/bson/bson_encoder.hpp>
 #include <jsoncons_ext/bson/bson_reader.hpp>
+#include <jsoncons_ext/bson/bson_cursor.hpp>
 
 namespace jsoncons { namespace bson {
 
@@ -74,10 +75,9 @@ template<class T>
 typename std::enable_if<!is_basic_json_class<T>::value,T>::type 
 decode_bson(const std::vector<uint8_t>& v)
 {
-    jsoncons::json_decoder<json> decoder;
-    basic_bson_reader<jsoncons::bytes_source> reader(v, decoder);
-    reader.read();
-    return decoder.get_result().template as<T>();
+    bson_bytes_cursor reader(v);
+    T val = read_from<T>(json(), reader);
+    return val;
 }
 
 template<class T>
@@ -95,10 +95,9 @@ template<class T>
 typename std::enable_if<!is_basic_json_class<T>::value,T>::type 
 decode_bson(std::istream& is)
 {
-    jsoncons::json_decoder<json> decoder;
-    bson_stream_reader reader(is, decoder);
-    reader.read();
-    return decoder.get_result();
+    bson_stream_cursor reader(is);
+    T val = read_from<T>(json(), reader);
+    return val;
 }
   
 }}
@@ -52,6 +52,7 @@ class basic_bson_parser : public ser_context
     bool continue_;
     bool done_;
     std::basic_string<char,std::char_traits<char>,char_allocator_type> text_buffer_;
+    std::vector<uint8_t,byte_allocator_type> bytes_buffer_;
     std::vector<parse_state,parse_state_allocator_type> state_stack_;
 public:
     template <class Source>
@@ -61,6 +62,7 @@ public:
          continue_(true), 
          done_(false),
          text_buffer_(allocator),
+         bytes_buffer_(allocator),
          state_stack_(allocator)
     {
         state_stack_.emplace_back(parse_mode::root,0);
@@ -263,22 +265,22 @@ private:
                 const uint8_t* endp;
                 auto len = jsoncons::detail::little_to_native<int32_t>(buf, buf+sizeof(buf),&endp);
 
-                std::basic_string<char> s;
-                s.reserve(len - 1);
-                if ((int32_t)source_.read(std::back_inserter(s), len-1) != len-1)
+                text_buffer_.clear();
+                text_buffer_.reserve(len - 1);
+                if ((int32_t)source_.read(std::back_inserter(text_buffer_), len-1) != len-1)
                 {
                     ec = bson_errc::unexpected_eof;
                     return;
                 }
                 uint8_t c{};
                 source_.get(c); // discard 0
-                auto result = unicons::validate(s.begin(),s.end());
+                auto result = unicons::validate(text_buffer_.begin(),text_buffer_.end());
                 if (result.ec != unicons::conv_errc())
                 {
                     ec = bson_errc::invalid_utf8_text_string;
                     return;
                 }
-                continue_ = handler.string_value(basic_string_view<char>(s.data(),s.length()), semantic_tag::none, *this);
+                continue_ = handler.string_value(basic_string_view<char>(text_buffer_.data(),text_buffer_.length()), semantic_tag::none, *this);
                 break;
             }
             case jsoncons::bson::detail::bson_format::document_cd: 
@@ -374,14 +376,14 @@ private:
                 const uint8_t* endp;
                 const auto len = jsoncons::detail::little_to_native<int32_t>(buf, buf+sizeof(int32_t),&endp);
 
-                std::vector<uint8_t> v(len, 0);
-                if (source_.read(v.data(), v.size()) != v.size())
+                bytes_buffer_.assign(len, 0);
+                if (source_.read(bytes_buffer_.data(), bytes_buffer_.size()) != bytes_buffer_.size())
                 {
                     ec = bson_errc::unexpected_eof;
                     return;
                 }
 
-                continue_ = handler.byte_string_value(byte_string_view(v.data(),v.size()), 
+                continue_ = handler.byte_string_value(byte_string_view(bytes_buffer_.data(),bytes_buffer_.size()), 
                                            semantic_tag::none, 
                                            *this);
                 break;
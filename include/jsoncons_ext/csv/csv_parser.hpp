@@ -20,6 +20,7 @@
 #include <jsoncons/json_filter.hpp>
 #include <jsoncons/json.hpp>
 #include <jsoncons/detail/parse_number.hpp>
+#include <jsoncons/detail/decimal_to_double.hpp>
 #include <jsoncons_ext/csv/csv_error.hpp>
 #include <jsoncons_ext/csv/csv_options.hpp>
 
@@ -505,7 +506,6 @@ class basic_csv_parser : public ser_context
     size_t column_index_;
     size_t level_;
     size_t offset_;
-    jsoncons::detail::string_to_double to_double_; 
     const CharT* begin_input_;
     const CharT* input_end_;
     const CharT* input_ptr_;
@@ -1762,7 +1762,6 @@ private:
 
         auto last = buffer_.end();
 
-        std::string buffer;
         for (auto p = buffer_.begin(); state != numeric_check_state::done && p != last; ++p)
         {
             switch (state)
@@ -1803,17 +1802,14 @@ private:
                         break;
                     case '-':
                         is_negative = true;
-                        buffer.push_back(*p);
                         state = numeric_check_state::minus;
                         break;
                     case '0':
                         ++precision;
-                        buffer.push_back(*p);
                         state = numeric_check_state::zero;
                         break;
                     case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         ++precision;
-                        buffer.push_back(*p);
                         state = numeric_check_state::integer;
                         break;
                     default:
@@ -1827,11 +1823,9 @@ private:
                     switch (*p)
                     {
                     case '.':
-                        buffer.push_back(to_double_.get_decimal_point());
                         state = numeric_check_state::fraction1;
                         break;
                     case 'e':case 'E':
-                        buffer.push_back(*p);
                         state = numeric_check_state::exp1;
                         break;
                     default:
@@ -1846,14 +1840,11 @@ private:
                     {
                     case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         ++precision;
-                        buffer.push_back(*p);
                         break;
                     case '.':
-                        buffer.push_back(to_double_.get_decimal_point());
                         state = numeric_check_state::fraction1;
                         break;
                     case 'e':case 'E':
-                        buffer.push_back(*p);
                         state = numeric_check_state::exp1;
                         break;
                     default:
@@ -1868,16 +1859,13 @@ private:
                     {
                     case '0':
                         ++precision;
-                        buffer.push_back(*p);
                         state = numeric_check_state::zero;
                         break;
                     case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         ++precision;
-                        buffer.push_back(*p);
                         state = numeric_check_state::integer;
                         break;
                     case 'e':case 'E':
-                        buffer.push_back(*p);
                         state = numeric_check_state::exp1;
                         break;
                     default:
@@ -1893,7 +1881,6 @@ private:
                     case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         ++precision;
                         ++decimal_places;
-                        buffer.push_back(*p);
                         state = numeric_check_state::fraction;
                         break;
                     default:
@@ -1909,10 +1896,8 @@ private:
                     case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         ++precision;
                         ++decimal_places;
-                        buffer.push_back(*p);
                         break;
                     case 'e':case 'E':
-                        buffer.push_back(*p);
                         state = numeric_check_state::exp1;
                         break;
                     default:
@@ -1926,14 +1911,12 @@ private:
                     switch (*p)
                     {
                     case '-':
-                        buffer.push_back(*p);
                         state = numeric_check_state::exp;
                         break;
                     case '+':
                         state = numeric_check_state::exp;
                         break;
                     case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
-                        buffer.push_back(*p);
                         state = numeric_check_state::integer;
                         break;
                     default:
@@ -1947,7 +1930,6 @@ private:
                     switch (*p)
                     {
                     case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
-                        buffer.push_back(*p);
                         break;
                     default:
                         state = numeric_check_state::done;
@@ -2013,8 +1995,15 @@ private:
                 }
                 else
                 {
-                    double d = to_double_(buffer.c_str(), buffer.length());
-                    continue_ = handler_->double_value(d, semantic_tag::none, *this);
+                    auto result = jsoncons::detail::decimal_to_double(buffer_.data(), buffer_.length());
+                    if (result.valid)
+                    {
+                        continue_ = handler_->double_value(result.value, semantic_tag::none, *this);
+                    }
+                    else
+                    {
+                        continue_ = handler_->string_value(buffer_, semantic_tag::none, *this);
+                    }
                 }
                 break;
             }
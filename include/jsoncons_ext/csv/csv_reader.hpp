@@ -228,32 +228,46 @@ private:
     }
     void read_buffer(std::error_code& ec)
     {
-        buffer_.clear();
-        buffer_.resize(buffer_length_);
-        size_t count = source_.read(buffer_.data(), buffer_length_);
-        buffer_.resize(static_cast<size_t>(count));
-        if (buffer_.size() == 0)
+        const CharT* data;
+        size_t count = read_source(data, is_contiguous_source<Src>());
+        if (count == 0)
         {
             eof_ = true;
         }
         else if (begin_)
         {
-            auto result = unicons::skip_bom(buffer_.begin(), buffer_.end());
+            auto result = unicons::skip_bom(data, data+count);
             if (result.ec != unicons::encoding_errc())
             {
                 ec = result.ec;
                 return;
             }
-            size_t offset = result.it - buffer_.begin();
-            parser_.update(buffer_.data()+offset,buffer_.size()-offset);
+            size_t offset = result.it - data;
+            parser_.update(data+offset,count-offset);
             begin_ = false;
         }
         else
         {
-            parser_.update(buffer_.data(),buffer_.size());
+            parser_.update(data,count);
         }
     }
 
+    // Sources that hold their input in memory are parsed in place
+    size_t read_source(const CharT*& data, std::true_type)
+    {
+        return source_.read_view(data, buffer_length_);
+    }
+
+    size_t read_source(const CharT*& data, std::false_type)
+    {
+        buffer_.clear();
+        buffer_.resize(buffer_length_);
+        size_t count = source_.read(buffer_.data(), buffer_length_);
+        buffer_.resize(static_cast<size_t>(count));
+        data = buffer_.data();
+        return count;
+    }
+
 };
 
 typedef basic_csv_reader<char> csv_reader;
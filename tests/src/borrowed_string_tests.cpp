@@ -0,0 +1,147 @@
+// Copyright 2013 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    bool points_into(const std::vector<char>& buffer, const json& j)
+    {
+        auto sv = j.as_string_view();
+        return sv.data() >= buffer.data() && sv.data() + sv.length() <= buffer.data() + buffer.size();
+    }
+}
+
+TEST_CASE("test_borrowed_string")
+{
+    std::string s = "A string that is too long to be a short string";
+
+    json j(borrowed_string_arg, s);
+    CHECK(j.type() == storage_type::borrowed_string_value);
+    CHECK(j.is_string());
+    CHECK(j.as_string_view().data() == s.data());
+    CHECK(j.as<std::string>() == s);
+    CHECK(j == json(s));
+    CHECK_FALSE(j < json(s));
+    CHECK_FALSE(json(s) < j);
+
+    json copy(j);
+    CHECK(copy.type() == storage_type::borrowed_string_value);
+    CHECK(copy.as_string_view().data() == s.data());
+
+    json number(borrowed_string_arg, string_view("1.5"));
+    CHECK(number.as<double>() == 1.5);
+
+    CHECK(json(1) < j);
+    CHECK(j < json::array({1}));
+    CHECK_THROWS_WITH(j.as<const char*>(), "Not a cstring: borrowed string, call detach() first");
+    CHECK(j.get_allocator() == json::allocator_type());
+
+    j.detach();
+    CHECK(j.type() == storage_type::long_string_value);
+    CHECK(j.as<std::string>() == s);
+    CHECK(std::string(j.as<const char*>()) == s);
+    CHECK(sizeof(json) == 16);
+}
+
+TEST_CASE("test_detach_deep_document")
+{
+    std::string s = "A string that is too long to be a short string";
+
+    const size_t depth = 100000;
+    json j(borrowed_string_arg, s);
+    for (size_t i = 0; i < depth; ++i)
+    {
+        json a = json::array();
+        a.push_back(std::move(j));
+        j = std::move(a);
+    }
+    j.detach();
+
+    const json* p = &j;
+    for (size_t i = 0; i < depth; ++i)
+    {
+        p = &p->at(0);
+    }
+    CHECK(p->type() == storage_type::long_string_value);
+    CHECK(p->as<std::string>() == s);
+
+    // Release iteratively, since the destructor recurses
+    while (j.is_array() && j.size() > 0)
+    {
+        json inner = std::move(j[0]);
+        j = std::move(inner);
+    }
+}
+
+TEST_CASE("test_json_decoder_borrow_strings")
+{
+    std::string input = R"({"first":"value1","second":["value2","with \"escape\"",10],"third":"x"})";
+
+    SECTION("update")
+    {
+        std::vector<char> buffer(input.begin(), input.end());
+
+        json_decoder<json> decoder;
+        decoder.borrow_strings(buffer.data(), buffer.size());
+        json_parser parser;
+        parser.update(buffer.data(), buffer.size());
+        parser.parse_some(decoder);
+        parser.finish_parse(decoder);
+        parser.check_done();
+
+        json j = decoder.get_result();
+        CHECK(j == json::parse(input));
+        CHECK(j["first"].type() == storage_type::borrowed_string_value);
+        CHECK(points_into(buffer, j["first"]));
+        CHECK(j["second"][0].type() == storage_type::borrowed_string_value);
+        // Escaped strings are unescaped into the parser's buffer, so they are copied
+        CHECK(j["second"][1].type() != storage_type::borrowed_string_value);
+
+        j.detach();
+        std::fill(buffer.begin(), buffer.end(), ' ');
+        CHECK(j["first"].type() == storage_type::short_string_value);
+        CHECK(j == json::parse(input));
+    }
+
+    SECTION("update_insitu")
+    {
+        std::vector<char> buffer(input.begin(), input.end());
+
+        json_decoder<json> decoder;
+        decoder.borrow_strings(buffer.data(), buffer.size());
+        json_parser parser;
+        parser.update_insitu(buffer.data(), buffer.size());
+        parser.parse_some(decoder);
+        parser.finish_parse(decoder);
+        parser.check_done();
+
+        json j = decoder.get_result();
+        CHECK(j == json::parse(input));
+        CHECK(j["second"][1].type() == storage_type::borrowed_string_value);
+        CHECK(points_into(buffer, j["second"][1]));
+        CHECK(j["second"][1].as<std::string>() == "with \"escape\"");
+    }
+
+    SECTION("root string")
+    {
+        std::string root = R"("root value")";
+        json_decoder<json> decoder;
+        decoder.borrow_strings(root.data(), root.size());
+        json_parser parser;
+        parser.update(root.data(), root.size());
+        parser.parse_some(decoder);
+        parser.finish_parse(decoder);
+
+        json j = decoder.get_result();
+        CHECK(j.type() == storage_type::borrowed_string_value);
+        CHECK(j.as_string_view().data() == root.data() + 1);
+    }
+}
@@ -243,5 +243,36 @@ TEST_CASE("serialize to bson")
                                      };
         jsoncons::bson::check_equal(v,bson);
     }
+
+    SECTION("int32 range")
+    {
+        std::vector<uint8_t> v;
+        bson::bson_bytes_encoder encoder(v);
+
+        encoder.begin_object();
+        encoder.name("0");
+        encoder.int64_value(-1);
+        encoder.name("1");
+        encoder.uint64_value(7);
+        encoder.end_object();
+        encoder.flush();
+
+        std::vector<uint8_t> bson = {0x13,0x00,0x00,0x00,
+                                     0x10, // int32
+                                     0x30, // '0'
+                                     0x00, // terminator
+                                     0xff,0xff,0xff,0xff,
+                                     0x10, // int32
+                                     0x31, // '1'
+                                     0x00, // terminator
+                                     0x07,0x00,0x00,0x00,
+                                     0x00 // terminator
+                                     };
+        jsoncons::bson::check_equal(v,bson);
+
+        json j = bson::decode_bson<json>(v);
+        CHECK(j["0"].as<int>() == -1);
+        CHECK(j["1"].as<int>() == 7);
+    }
 }
 
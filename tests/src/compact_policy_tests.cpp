@@ -0,0 +1,270 @@
+// Copyright 2019 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+typedef basic_json<char,compact_policy,std::allocator<char>> cjson;
+
+TEST_CASE("compact_policy size")
+{
+    CHECK(sizeof(cjson) == 8);
+}
+
+TEST_CASE("compact_policy scalars")
+{
+    SECTION("null and bool")
+    {
+        cjson a = cjson::null();
+        CHECK(a.is_null());
+        CHECK(cjson(true).as<bool>());
+        CHECK_FALSE(cjson(false).as<bool>());
+        CHECK(cjson(true).type() == storage_type::bool_value);
+    }
+
+    SECTION("double")
+    {
+        cjson a(1.5);
+        CHECK(a.type() == storage_type::double_value);
+        CHECK(a.as<double>() == 1.5);
+        CHECK(cjson(-0.0).as<double>() == 0.0);
+        CHECK(cjson(std::numeric_limits<double>::infinity()).as<double>() == std::numeric_limits<double>::infinity());
+
+        cjson nan(std::nan(""));
+        CHECK(nan.type() == storage_type::double_value);
+        CHECK(std::isnan(nan.as<double>()));
+        CHECK(cjson(-std::nan("")).type() == storage_type::double_value);
+    }
+
+    SECTION("integers")
+    {
+        const int64_t min48 = -(int64_t(1) << 47);
+        const int64_t max48 = (int64_t(1) << 47) - 1;
+        CHECK(cjson(min48).as<int64_t>() == min48);
+        CHECK(cjson(max48).as<int64_t>() == max48);
+        CHECK(cjson(-1).as<int64_t>() == -1);
+        CHECK(cjson(max48 + 1).as<int64_t>() == max48 + 1);
+        CHECK(cjson(min48 - 1).as<int64_t>() == min48 - 1);
+        CHECK(cjson((std::numeric_limits<int64_t>::min)()).as<int64_t>() == (std::numeric_limits<int64_t>::min)());
+        CHECK(cjson((std::numeric_limits<uint64_t>::max)()).as<uint64_t>() == (std::numeric_limits<uint64_t>::max)());
+        CHECK(cjson(uint64_t(1) << 48).as<uint64_t>() == uint64_t(1) << 48);
+        CHECK(cjson(uint64_t(7)).type() == storage_type::uint64_value);
+        CHECK(cjson(int64_t(7)).type() == storage_type::int64_value);
+    }
+
+    SECTION("strings")
+    {
+        cjson a("abcd");
+        CHECK(a.type() == storage_type::short_string_value);
+        CHECK(a.as<std::string>() == "abcd");
+        CHECK(a.as_string_view() == "abcd");
+        CHECK(std::string(a.as_cstring()) == "abcd");
+
+        cjson b("");
+        CHECK(b.as<std::string>() == "");
+
+        cjson c("abcdefghijklmnopqrstuvwxyz");
+        CHECK(c.type() == storage_type::long_string_value);
+        CHECK(c.as<std::string>() == "abcdefghijklmnopqrstuvwxyz");
+
+        cjson d("abcdefg");
+        CHECK(d.as<std::string>() == "abcdefg");
+    }
+
+    SECTION("tags")
+    {
+        cjson a(1, semantic_tag::timestamp);
+        CHECK(a.tag() == semantic_tag::timestamp);
+        CHECK(a.as<int>() == 1);
+
+        cjson b("2019-01-01", semantic_tag::datetime);
+        CHECK(b.tag() == semantic_tag::datetime);
+        CHECK(b.as<std::string>() == "2019-01-01");
+
+        cjson c(null_type(), semantic_tag::undefined);
+        CHECK(c.is_null());
+        CHECK(c.tag() == semantic_tag::undefined);
+
+        cjson d(byte_string({'H','e','l','l','o'}));
+        CHECK(d.is_byte_string());
+        CHECK(d.as<byte_string>() == byte_string({'H','e','l','l','o'}));
+    }
+}
+
+TEST_CASE("compact_policy containers")
+{
+    cjson j = cjson::parse(R"({"a":[1,2.5,"x",null,true,{}],"b":{"c":[]},"d":"a long string value","e":18446744073709551615})");
+    CHECK(j["a"].size() == 6);
+    CHECK(j["a"][1].as<double>() == 2.5);
+    CHECK(j["a"][5].type() == storage_type::empty_object_value);
+    CHECK(j["b"]["c"].type() == storage_type::empty_array_value);
+    CHECK(j["e"].as<uint64_t>() == (std::numeric_limits<uint64_t>::max)());
+    CHECK(j.to_string() == R"({"a":[1,2.5,"x",null,true,{}],"b":{"c":[]},"d":"a long string value","e":18446744073709551615})");
+
+    j["a"].push_back(3);
+    j["f"] = "new";
+    CHECK(j["a"].size() == 7);
+    CHECK(j["f"].as<std::string>() == "new");
+
+    cjson copy(j);
+    CHECK(copy == j);
+    copy["a"][0] = 2;
+    CHECK(copy != j);
+    CHECK(j < copy);
+
+    cjson moved(std::move(copy));
+    CHECK(moved["a"][0].as<int>() == 2);
+    CHECK(copy.is_null());
+
+    swap(moved, j);
+    CHECK(j["a"][0].as<int>() == 2);
+    CHECK(moved["a"][0].as<int>() == 1);
+}
+
+TEST_CASE("compact_policy comparison")
+{
+    CHECK(cjson(1) == cjson(1.0));
+    CHECK(cjson(1) == cjson(uint64_t(1)));
+    CHECK(cjson("abc") == cjson(std::string("abc")));
+    CHECK(cjson("abc") < cjson("abd"));
+    CHECK(cjson("abc") == cjson("abc", semantic_tag::none));
+    CHECK(cjson("short") != cjson("a long string value"));
+    CHECK_FALSE(cjson(std::nan("")) == cjson(std::nan("")));
+    CHECK(cjson::parse("[1,2]") == cjson::parse("[1,2]"));
+}
+
+namespace {
+
+    size_t compact_allocations = 0;
+
+    template <class T>
+    struct counting_allocator
+    {
+        typedef T value_type;
+
+        counting_allocator() = default;
+
+        template <class U>
+        counting_allocator(const counting_allocator<U>&) noexcept
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            ++compact_allocations;
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        template <class U>
+        struct rebind
+        {
+            typedef counting_allocator<U> other;
+        };
+
+        friend bool operator==(const counting_allocator&, const counting_allocator&) noexcept
+        {
+            return true;
+        }
+
+        friend bool operator!=(const counting_allocator&, const counting_allocator&) noexcept
+        {
+            return false;
+        }
+    };
+}
+
+TEST_CASE("compact_policy heap data")
+{
+    typedef basic_json<char,compact_policy,counting_allocator<char>> counted_json;
+
+    SECTION("untagged strings are stored as a pointer")
+    {
+        compact_allocations = 0;
+        counted_json a("a long string value");
+        CHECK(compact_allocations == 1);
+        CHECK(a.type() == storage_type::long_string_value);
+
+        // Longer than an inline string, short enough for a variant's short string
+        compact_allocations = 0;
+        counted_json b("abcdefg");
+        CHECK(compact_allocations == 1);
+        CHECK(b.type() == storage_type::long_string_value);
+        CHECK(std::string(b.as_cstring()) == "abcdefg");
+
+        counted_json c(b);
+        CHECK(c == b);
+        CHECK(c.as_string_view().data() != b.as_string_view().data());
+        CHECK(counted_json("abcdefh") != b);
+        CHECK(b < counted_json("abcdefh"));
+    }
+
+    SECTION("tagged strings are boxed")
+    {
+        compact_allocations = 0;
+        counted_json a("a long string value", semantic_tag::datetime);
+        CHECK(compact_allocations == 2);
+        CHECK(a.tag() == semantic_tag::datetime);
+        CHECK(a.as<std::string>() == "a long string value");
+        CHECK(a == counted_json("a long string value"));
+    }
+
+    SECTION("byte strings")
+    {
+        counted_json a(byte_string({'H','e','l','l','o'}));
+        CHECK(a.type() == storage_type::byte_string_value);
+        CHECK(a.as_byte_string_view() == byte_string_view(byte_string({'H','e','l','l','o'})));
+        counted_json b(a);
+        CHECK(b == a);
+        CHECK(b.as<byte_string>() == byte_string({'H','e','l','l','o'}));
+
+        counted_json c(byte_string({'H','e','l','l','o'}), semantic_tag::base64);
+        CHECK(c.tag() == semantic_tag::base64);
+        CHECK(c == a);
+        CHECK(c.as<std::string>() == json(byte_string({'H','e','l','l','o'}), semantic_tag::base64).as<std::string>());
+    }
+
+    SECTION("containers")
+    {
+        counted_json j = counted_json::parse(R"({"a":[1,{"b":"a long string value"}],"c":"abcdefg"})");
+        counted_json copy(j);
+        CHECK(copy == j);
+        copy["a"][1]["b"] = "another long string value";
+        CHECK(j["a"][1]["b"].as<std::string>() == "a long string value");
+        CHECK(copy["a"][1]["b"].as<std::string>() == "another long string value");
+        CHECK(j < copy);
+
+        j = std::move(copy);
+        CHECK(j["a"][1]["b"].as<std::string>() == "another long string value");
+        CHECK(j["a"].size() == 2);
+        CHECK(j.size() == 2);
+    }
+}
+
+TEST_CASE("compact_policy wide strings")
+{
+    typedef basic_json<wchar_t,compact_policy,std::allocator<char>> wcjson;
+
+    wcjson a(L"");
+    CHECK(a.type() == storage_type::short_string_value);
+    CHECK(a.as<std::wstring>() == L"");
+    CHECK(std::wstring(a.as_cstring()) == L"");
+
+    wcjson b(L"ab");
+    CHECK(b.type() == storage_type::long_string_value);
+    CHECK(b.as<std::wstring>() == L"ab");
+
+    wcjson j = wcjson::parse(L"[\"\",\"x\",\"a long string value\"]");
+    CHECK(j[1].as<std::wstring>() == L"x");
+    CHECK(j == wcjson::parse(L"[\"\",\"x\",\"a long string value\"]"));
+}
@@ -1365,6 +1365,27 @@ EUR_LIBOR_06M,2015-10-27,0.0000001
     CHECK((j[2]["rate"].as<std::string>() == "0.0000001"));
 }
 
+TEST_CASE("csv malformed exponent")
+{
+    const std::string input = R"(a,b,c
+1e+,1.5e-,2.5e+3
+)";
+
+    csv::csv_options options;
+    options.assume_header(true)
+           .mapping(csv::mapping_type::n_objects);
+
+    // An exponent without digits is kept as text rather than parsed as its numeric prefix
+    json j = csv::decode_csv<json>(input,options);
+    REQUIRE(j.size() == 1);
+    CHECK(j[0]["a"].is_string());
+    CHECK(j[0]["a"].as<std::string>() == "1e+");
+    CHECK(j[0]["b"].is_string());
+    CHECK(j[0]["b"].as<std::string>() == "1.5e-");
+    CHECK(j[0]["c"].is_double());
+    CHECK(j[0]["c"].as<double>() == 2500.0);
+}
+
 // Test case contributed by karimhm
 TEST_CASE("csv detect bom")
 {
@@ -0,0 +1,134 @@
+// Copyright 2019 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/detail/decimal_to_double.hpp>
+#include <catch/catch.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    bool same_bits(double a, double b)
+    {
+        return std::memcmp(&a, &b, sizeof(double)) == 0;
+    }
+
+    void check_decimal_to_double(const std::string& s)
+    {
+        auto result = jsoncons::detail::decimal_to_double(s.data(), s.length());
+        double expected = std::strtod(s.c_str(), nullptr);
+        INFO(s);
+        CHECK(result.valid);
+        CHECK(same_bits(result.value, expected));
+    }
+}
+
+TEST_CASE("decimal_to_double hard cases")
+{
+    std::vector<std::string> inputs = {
+        "0.1", "-0.0", "0e10", "1e23", "8.41e21", "9007199254740993", "9007199254740992.5",
+        "2.2250738585072011e-308", "2.2250738585072012e-308", "2.2250738585072013e-308",
+        "4.9406564584124654e-324", "2.4703282292062327e-324", "2.4703282292062328e-324",
+        "1.7976931348623157e308", "1.7976931348623158e308", "1.7976931348623159e308",
+        "1e309", "-1e309", "1e-400", "123456789012345678901234567890",
+        "7.3177701707893310e+15", "1.15507e-173",
+        // halfway between 1 and the next double, and either side of it
+        "1.00000000000000011102230246251565404236316680908203125",
+        "1.00000000000000011102230246251565404236316680908203124",
+        "1.00000000000000011102230246251565404236316680908203126",
+        "2.470328229206232720882538e-324", "2.470328229206232720882539e-324"
+    };
+    for (const auto& s : inputs)
+    {
+        check_decimal_to_double(s);
+    }
+}
+
+TEST_CASE("decimal_to_double many digits")
+{
+    // 2^-1074 * 2^52 written out in full, just below the smallest normal
+    std::string s = "0.";
+    s.append(307, '0');
+    s.append("22250738585072008890245868760858598876504231122409594654935248025624400092282356951787758888037591552642309780950434312085877387158357291821993020294379224223559819827501242041788969571311791082261043971979604000454897391938079198936081525613113376149842043271751033627391549782731594143828136275113838604094249464942286316695429105080201815926642134996606517803095075913058719846423906068637102005108723282784678843631944515866135041223479014792369585208321597621066375401613736583044193603714778355306682834535634005074073040135602968046375918583163124224521599262546494300836851861719422417646455137135420132217031370496583210154654068035397417906022589503023501937519773030945763173210852507299305089761582519159720757232455434770912461317493580281734466552734375");
+    check_decimal_to_double(s);
+    check_decimal_to_double("1" + std::string(400, '0') + "e-400");
+    check_decimal_to_double("0." + std::string(400, '0') + "1e400");
+}
+
+TEST_CASE("decimal_to_double invalid input")
+{
+    std::vector<std::string> inputs = {"", "-", "1.", "1e", "1e+", "1x", "1.5e5x"};
+    for (const auto& s : inputs)
+    {
+        auto result = jsoncons::detail::decimal_to_double(s.data(), s.length());
+        INFO(s);
+        CHECK_FALSE(result.valid);
+    }
+}
+
+TEST_CASE("json_parser numbers split across buffers")
+{
+    std::string input = R"([-1.5e+3, 18446744073709551616, 0.30000000000000004, -12345678901234567890, 2.5E-3])";
+    json expected = json::parse(input);
+
+    for (size_t chunk_size = 1; chunk_size <= input.size(); ++chunk_size)
+    {
+        json_decoder<json> decoder;
+        json_parser parser;
+        std::error_code ec;
+        size_t offset = 0;
+        while (!parser.finished())
+        {
+            if (parser.source_exhausted() && offset < input.size())
+            {
+                size_t length = (std::min)(chunk_size, input.size() - offset);
+                parser.update(input.data() + offset, length);
+                offset += length;
+            }
+            parser.parse_some(decoder, ec);
+            REQUIRE_FALSE(ec);
+        }
+        CHECK(decoder.get_result() == expected);
+    }
+    CHECK(expected[0].as<double>() == -1500.0);
+    CHECK(expected[1].tag() == semantic_tag::bigint);
+    CHECK(expected[2].as<double>() == 0.30000000000000004);
+    CHECK(expected[4].as<double>() == 0.0025);
+}
+
+TEST_CASE("json_parser lossless number text across buffers")
+{
+    std::string input = "[1.00000000000000000001,-0.5e-7]";
+    json_options options;
+    options.lossless_number(true);
+
+    for (size_t chunk_size = 1; chunk_size <= input.size(); ++chunk_size)
+    {
+        json_decoder<json> decoder;
+        json_parser parser(options);
+        std::error_code ec;
+        size_t offset = 0;
+        while (!parser.finished())
+        {
+            if (parser.source_exhausted() && offset < input.size())
+            {
+                size_t length = (std::min)(chunk_size, input.size() - offset);
+                parser.update(input.data() + offset, length);
+                offset += length;
+            }
+            parser.parse_some(decoder, ec);
+            REQUIRE_FALSE(ec);
+        }
+        json j = decoder.get_result();
+        CHECK(j[0].as<std::string>() == "1.00000000000000000001");
+        CHECK(j[1].as<std::string>() == "-0.5e-7");
+    }
+}
@@ -0,0 +1,158 @@
+// Copyright 2019 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <stdexcept>
+#include <utility>
+
+using namespace jsoncons;
+
+TEST_CASE("empty array storage")
+{
+    SECTION("constructed from an empty array")
+    {
+        json j = json::array();
+        CHECK(j.type() == storage_type::empty_array_value);
+        CHECK(j.is_array());
+        CHECK_FALSE(j.is_object());
+        CHECK(j.size() == 0);
+        CHECK(j.empty());
+        CHECK(j.capacity() == 0);
+        CHECK((j.array_range().begin() == j.array_range().end()));
+        CHECK(j.to_string() == "[]");
+        CHECK(j == json::parse("[]"));
+        CHECK_THROWS_AS(j.at(0), std::out_of_range);
+    }
+
+    SECTION("tag is kept")
+    {
+        json j(json::array(), semantic_tag::datetime);
+        CHECK(j.type() == storage_type::empty_array_value);
+        CHECK(j.tag() == semantic_tag::datetime);
+        j.push_back(1);
+        CHECK(j.tag() == semantic_tag::datetime);
+    }
+
+    SECTION("const range access does not allocate")
+    {
+        const json j = json::array();
+        for (const auto& item : j.array_range())
+        {
+            CHECK(item.is_null());
+        }
+        CHECK(j.type() == storage_type::empty_array_value);
+        CHECK(j.array_value().size() == 0);
+    }
+
+    SECTION("spills on growth")
+    {
+        json j = json::array();
+        j.push_back(1);
+        CHECK(j.type() == storage_type::array_value);
+        CHECK(j.to_string() == "[1]");
+
+        json k = json::array();
+        k.emplace_back("a");
+        CHECK(k.to_string() == "[\"a\"]");
+
+        json l = json::array();
+        l.insert(l.array_range().end(), 2);
+        l.insert(l.array_range().begin(), 1);
+        CHECK(l.to_string() == "[1,2]");
+
+        json m = json::array();
+        m.resize(2);
+        CHECK(m.size() == 2);
+    }
+
+    SECTION("no-op modifiers")
+    {
+        json j = json::array();
+        j.reserve(0);
+        j.resize(0);
+        j.clear();
+        j.shrink_to_fit();
+        j.erase(j.array_range().begin(), j.array_range().end());
+        CHECK(j.type() == storage_type::empty_array_value);
+
+        j.reserve(10);
+        CHECK(j.type() == storage_type::array_value);
+        CHECK(j.capacity() >= 10);
+    }
+
+    SECTION("compares with an allocated empty array")
+    {
+        json a = json::array();
+        json b = json::array();
+        b.push_back(1);
+        b.clear();
+        CHECK(b.type() == storage_type::array_value);
+        CHECK(a == b);
+        CHECK(b == a);
+        CHECK_FALSE(a < b);
+        CHECK_FALSE(b < a);
+
+        json c = json::parse("[1]");
+        CHECK(a < c);
+        CHECK_FALSE(c < a);
+        CHECK(a < json());
+        CHECK(json("a") < a);
+        CHECK(json::parse("[]") < json::parse("{}"));
+        CHECK_FALSE(json::object() < json::array());
+    }
+
+    SECTION("copy, move and swap")
+    {
+        json a = json::array();
+        json b(a);
+        CHECK(b.type() == storage_type::empty_array_value);
+        json c(std::move(b));
+        CHECK(c.type() == storage_type::empty_array_value);
+
+        json d = json::parse("[1,2]");
+        swap(c, d);
+        CHECK(c.size() == 2);
+        CHECK(d.type() == storage_type::empty_array_value);
+        d = c;
+        CHECK(d.size() == 2);
+    }
+}
+
+TEST_CASE("empty object storage")
+{
+    json j = json::object();
+    CHECK(j.type() == storage_type::empty_object_value);
+    CHECK(j.to_string() == "{}");
+
+    j["a"] = 1;
+    CHECK(j.type() == storage_type::object_value);
+}
+
+TEST_CASE("decoded empty containers")
+{
+    SECTION("json")
+    {
+        json j = json::parse(R"({"a":[],"b":{},"c":[[],{}],"d":[1]})");
+        CHECK(j["a"].type() == storage_type::empty_array_value);
+        CHECK(j["b"].type() == storage_type::empty_object_value);
+        CHECK(j["c"][0].type() == storage_type::empty_array_value);
+        CHECK(j["c"][1].type() == storage_type::empty_object_value);
+        CHECK(j["d"].type() == storage_type::array_value);
+        CHECK(j.to_string() == R"({"a":[],"b":{},"c":[[],{}],"d":[1]})");
+    }
+
+    SECTION("ojson")
+    {
+        ojson j = ojson::parse(R"({"b":[],"a":{}})");
+        CHECK(j["b"].type() == storage_type::empty_array_value);
+        CHECK(j["a"].type() == storage_type::empty_object_value);
+        CHECK(j.to_string() == R"({"b":[],"a":{}})");
+    }
+
+    SECTION("root")
+    {
+        CHECK(json::parse("[]").type() == storage_type::empty_array_value);
+        CHECK(json::parse("{}").type() == storage_type::empty_object_value);
+    }
+}
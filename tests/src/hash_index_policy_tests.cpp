@@ -0,0 +1,178 @@
+// Copyright 2019 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+typedef basic_json<char,hash_index_policy,std::allocator<char>> hjson;
+
+TEST_CASE("test_hash_index_policy_insertion_order")
+{
+    hjson j = hjson::parse(R"({"street_number":"100","street_name":"Queen St W","city":"Toronto","country":"Canada"})");
+
+    std::vector<std::string> keys;
+    for (const auto& member : j.object_range())
+    {
+        keys.push_back(member.key());
+    }
+    REQUIRE(keys.size() == 4);
+    CHECK(keys[0] == "street_number");
+    CHECK(keys[3] == "country");
+    CHECK(j["city"].as<std::string>() == "Toronto");
+
+    j.insert_or_assign("province","Ontario");
+    j.insert_or_assign("city","Old Toronto");
+    CHECK(j.size() == 5);
+    CHECK(j.at(4).as<std::string>() == "Ontario");
+    CHECK(j["city"].as<std::string>() == "Old Toronto");
+
+    CHECK(j.to_string() == R"({"street_number":"100","street_name":"Queen St W","city":"Old Toronto","country":"Canada","province":"Ontario"})");
+}
+
+TEST_CASE("test_hash_index_policy_large_object")
+{
+    const size_t n = 1000;
+    hjson j;
+    for (size_t i = 0; i < n; ++i)
+    {
+        j.try_emplace(std::string("key") + std::to_string(i), i);
+    }
+    CHECK(j.size() == n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        std::string key = std::string("key") + std::to_string(i);
+        REQUIRE(j.contains(key));
+        CHECK(j[key].as<size_t>() == i);
+        CHECK(j.at(i).as<size_t>() == i);
+    }
+    CHECK_FALSE(j.contains("key1000"));
+
+    auto result = j.try_emplace("key5", 0);
+    CHECK_FALSE(result.second);
+    CHECK(result.first->value().as<size_t>() == 5);
+
+    SECTION("erase")
+    {
+        for (size_t i = 0; i < n; i += 2)
+        {
+            j.erase(std::string("key") + std::to_string(i));
+        }
+        CHECK(j.size() == n/2);
+        for (size_t i = 0; i < n; ++i)
+        {
+            std::string key = std::string("key") + std::to_string(i);
+            CHECK(j.contains(key) == (i % 2 == 1));
+        }
+        CHECK(j.at(0).as<size_t>() == 1);
+
+        j.erase(j.object_range().begin(), j.object_range().begin() + (n/2 - 4));
+        CHECK(j.size() == 4);
+        CHECK(j.contains("key999"));
+        CHECK_FALSE(j.contains("key991"));
+    }
+
+    SECTION("hint")
+    {
+        auto it = j.insert_or_assign(j.object_range().begin() + 10, "inserted", "here");
+        CHECK(it->key() == "inserted");
+        CHECK(j.at(10).as<std::string>() == "here");
+        CHECK(j.at(11).as<size_t>() == 10);
+        CHECK(j["key999"].as<size_t>() == 999);
+        CHECK(j["inserted"].as<std::string>() == "here");
+    }
+
+    SECTION("copy and swap")
+    {
+        hjson k(j);
+        CHECK(k == j);
+        hjson m = hjson::parse(R"({"a":1})");
+        k.swap(m);
+        CHECK(m == j);
+        CHECK(m["key500"].as<int>() == 500);
+        CHECK(k["a"].as<int>() == 1);
+        CHECK_FALSE(k.contains("key500"));
+    }
+}
+
+TEST_CASE("test_hash_index_policy_incremental_index")
+{
+    // Interleaved hinted inserts and erases keep every member findable at its position
+    hjson j;
+    std::vector<std::string> expected;
+    for (size_t i = 0; i < 200; ++i)
+    {
+        std::string key = std::string("k") + std::to_string(i);
+        size_t pos = (i * 7) % (expected.size() + 1);
+        if (i % 2 == 0)
+        {
+            j.insert_or_assign(j.object_range().begin() + pos, key, i);
+        }
+        else
+        {
+            j.try_emplace(j.object_range().begin() + pos, key, i);
+        }
+        expected.insert(expected.begin() + pos, key);
+
+        if (i % 5 == 4)
+        {
+            size_t erase_pos = (i * 3) % expected.size();
+            j.erase(expected[erase_pos]);
+            expected.erase(expected.begin() + erase_pos);
+        }
+        if (i % 23 == 22)
+        {
+            size_t first = (i * 11) % expected.size();
+            size_t last = first + 3 < expected.size() ? first + 3 : expected.size();
+            j.erase(j.object_range().begin() + first, j.object_range().begin() + last);
+            expected.erase(expected.begin() + first, expected.begin() + last);
+        }
+
+        REQUIRE(j.size() == expected.size());
+        for (size_t k = 0; k < expected.size(); ++k)
+        {
+            auto it = j.find(expected[k]);
+            REQUIRE((it != j.object_range().end()));
+            CHECK(static_cast<size_t>(it - j.object_range().begin()) == k);
+        }
+    }
+    CHECK_FALSE(j.contains("k4"));
+}
+
+TEST_CASE("test_hash_index_policy_duplicates_and_merge")
+{
+    hjson j = hjson::parse(R"({"a":1,"b":2,"a":3})");
+    CHECK(j.size() == 2);
+    CHECK(j["a"].as<int>() == 1);
+
+    hjson source;
+    for (int i = 0; i < 20; ++i)
+    {
+        source.insert_or_assign(std::string(1, static_cast<char>('a' + i)), i + 100);
+    }
+
+    hjson merged = j;
+    merged.merge(source);
+    CHECK(merged.size() == 20);
+    CHECK(merged["a"].as<int>() == 1);
+    CHECK(merged["t"].as<int>() == 119);
+
+    hjson updated = j;
+    updated.merge_or_update(source);
+    CHECK(updated.size() == 20);
+    CHECK(updated["a"].as<int>() == 100);
+    CHECK(updated.at(0).as<int>() == 100);
+
+    hjson hinted = j;
+    hinted.merge(hinted.object_range().begin(), source);
+    CHECK(hinted.size() == 20);
+    CHECK(hinted["s"].as<int>() == 118);
+    CHECK(hinted.at(1).as<int>() == 2);
+
+    hjson a = hjson::parse(R"({"x":1,"y":2})");
+    hjson b = hjson::parse(R"({"y":2,"x":1})");
+    CHECK(a != b);
+}
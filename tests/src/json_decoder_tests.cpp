@@ -0,0 +1,135 @@
+// Copyright 2019 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("json_decoder repeated object layouts")
+{
+    std::string input = R"(
+[
+    {"id":1,"name":"a","tags":{"y":1,"x":2}},
+    {"id":2,"name":"b","tags":{"y":3,"x":4}},
+    {"name":"c","id":3},
+    {"id":4,"name":"d","tags":{"x":5}},
+    {"id":5,"name":"e","tags":{"y":6,"x":7}}
+]
+)";
+
+    SECTION("json")
+    {
+        json j = json::parse(input);
+        REQUIRE(j.size() == 5);
+        CHECK(j[0].to_string() == R"({"id":1,"name":"a","tags":{"x":2,"y":1}})");
+        CHECK(j[1].to_string() == R"({"id":2,"name":"b","tags":{"x":4,"y":3}})");
+        CHECK(j[2].to_string() == R"({"id":3,"name":"c"})");
+        CHECK(j[4].to_string() == R"({"id":5,"name":"e","tags":{"x":7,"y":6}})");
+        CHECK(j[4]["tags"]["x"].as<int>() == 7);
+        CHECK(j[3]["tags"].size() == 1);
+    }
+
+    SECTION("ojson")
+    {
+        ojson j = ojson::parse(input);
+        REQUIRE(j.size() == 5);
+        CHECK(j[1].to_string() == R"({"id":2,"name":"b","tags":{"y":3,"x":4}})");
+        CHECK(j[2].to_string() == R"({"name":"c","id":3})");
+        CHECK(j[4]["tags"]["x"].as<int>() == 7);
+    }
+}
+
+TEST_CASE("json_decoder repeated layouts with duplicate keys")
+{
+    std::string input = R"([{"b":1,"a":2,"b":3},{"b":4,"a":5,"b":6},{"a":7,"b":8}])";
+
+    json j = json::parse(input);
+    REQUIRE(j.size() == 3);
+    for (size_t i = 0; i < 2; ++i)
+    {
+        CHECK(j[i].size() == 2);
+    }
+    CHECK(j[0]["b"].as<int>() == 1);
+    CHECK(j[1]["b"].as<int>() == 4);
+    CHECK(j[2].to_string() == R"({"a":7,"b":8})");
+
+    ojson oj = ojson::parse(input);
+    CHECK(oj[1].to_string() == R"({"b":4,"a":5})");
+}
+
+TEST_CASE("json_decoder objects with the same member count")
+{
+    std::string input = R"([{"c":1,"b":2,"a":3},{"a":4,"b":5,"c":6},{"z":7,"y":8,"x":9},{"c":10,"b":11,"a":12},{"b":13,"b":14,"a":15}])";
+
+    json j = json::parse(input);
+    REQUIRE(j.size() == 5);
+    CHECK(j[0].to_string() == R"({"a":3,"b":2,"c":1})");
+    CHECK(j[1].to_string() == R"({"a":4,"b":5,"c":6})");
+    CHECK(j[2].to_string() == R"({"x":9,"y":8,"z":7})");
+    CHECK(j[3].to_string() == R"({"a":12,"b":11,"c":10})");
+    CHECK(j[4].to_string() == R"({"a":15,"b":13})");
+
+    ojson oj = ojson::parse(input);
+    CHECK(oj[0].to_string() == R"({"c":1,"b":2,"a":3})");
+    CHECK(oj[2].to_string() == R"({"z":7,"y":8,"x":9})");
+    CHECK(oj[4].to_string() == R"({"b":13,"a":15})");
+}
+
+namespace {
+
+    std::string make_records(size_t n, bool vary_order)
+    {
+        const char* names[] = {"timestamp","user_id","event","session","country","device",
+                               "duration","status","referrer","browser","version","region"};
+        const size_t num_names = sizeof(names)/sizeof(names[0]);
+        std::string s = "[";
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (i > 0)
+            {
+                s.push_back(',');
+            }
+            s.push_back('{');
+            for (size_t k = 0; k < num_names; ++k)
+            {
+                if (k > 0)
+                {
+                    s.push_back(',');
+                }
+                s.push_back('"');
+                s.append(names[vary_order ? (k + i) % num_names : k]);
+                s.append("\":");
+                s.append(std::to_string(i*num_names+k));
+            }
+            s.push_back('}');
+        }
+        s.push_back(']');
+        return s;
+    }
+}
+
+TEST_CASE("json_decoder records with the same keys in different orders")
+{
+    std::string repeated = make_records(100, false);
+    std::string rotated = make_records(100, true);
+
+    json j1 = json::parse(repeated);
+    json j2 = json::parse(rotated);
+    REQUIRE(j1.size() == 100);
+    REQUIRE(j2.size() == 100);
+    for (size_t i = 0; i < j1.size(); ++i)
+    {
+        CHECK(j1[i].size() == 12);
+        CHECK(j1[i]["timestamp"].as<size_t>() == i*12);
+        CHECK(j1[i]["region"].as<size_t>() == i*12 + 11);
+        CHECK(j2[i].size() == 12);
+        CHECK(j2[i]["timestamp"].as<size_t>() == i*12 + (12 - i % 12) % 12);
+    }
+
+    ojson oj = ojson::parse(rotated);
+    CHECK(oj[1].object_range().begin()->key() == "user_id");
+    CHECK(oj[2].object_range().begin()->key() == "event");
+}
@@ -0,0 +1,186 @@
+// Copyright 2019 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_encoder.hpp>
+#include <jsoncons/json_image.hpp>
+#include <jsoncons/mmap_source.hpp>
+#include <catch/catch.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("test_json_image_lookup")
+{
+    json j = json::parse(R"(
+{
+    "user" : {"id" : 12345, "name" : "Jane Doe", "tags" : ["a","b","c"]},
+    "score" : 1.5e2,
+    "active" : true,
+    "none" : null,
+    "big" : 18446744073709551615,
+    "negative" : -7,
+    "empty" : {}
+}
+)");
+    std::vector<uint8_t> data;
+    encode_json_image(j, data);
+    json_image image(data);
+
+    CHECK(image["user"]["id"].as<int64_t>() == 12345);
+    CHECK(image["user"]["name"].as<std::string>() == "Jane Doe");
+    CHECK(image["user"]["name"].as<string_view>() == string_view("Jane Doe"));
+    CHECK(image["user"]["tags"][2].as<std::string>() == "c");
+    CHECK(image["user"]["tags"].size() == 3);
+    CHECK(image["score"].as<double>() == 150.0);
+    CHECK(image["active"].as<bool>());
+    CHECK(image["none"].is_null());
+    CHECK(image["big"].as<uint64_t>() == 18446744073709551615ULL);
+    CHECK(image["negative"].as<int>() == -7);
+    CHECK(image["empty"].is_object());
+    CHECK(image["empty"].empty());
+    CHECK(image.root().size() == 7);
+
+    CHECK(image.root().contains("score"));
+    CHECK_FALSE(image.root().contains("scores"));
+    CHECK_FALSE(image.root().contains("a"));
+    CHECK_FALSE(image.root().contains("zzz"));
+    CHECK_THROWS_AS(image["missing"], key_not_found);
+    CHECK_THROWS_AS(image["user"]["tags"][3], std::out_of_range);
+    CHECK_THROWS_AS(image["user"]["id"]["x"], not_an_object);
+
+    CHECK(image.to_json() == j);
+}
+
+TEST_CASE("test_json_image_sorted_members")
+{
+    ojson j = ojson::parse(R"({"c":1,"a":2,"b":{"z":[1,2],"y":true}})");
+    std::vector<uint8_t> data;
+    encode_json_image(j, data);
+    json_image image(data);
+
+    std::vector<std::string> keys;
+    for (const auto& member : image.root().object_range())
+    {
+        keys.push_back(std::string(member.key().data(), member.key().length()));
+    }
+    REQUIRE(keys.size() == 3);
+    CHECK(keys[0] == "a");
+    CHECK(keys[1] == "b");
+    CHECK(keys[2] == "c");
+    CHECK(image["b"]["z"][1].as<int>() == 2);
+    CHECK(image.to_json() == json::parse(R"({"c":1,"a":2,"b":{"z":[1,2],"y":true}})"));
+}
+
+TEST_CASE("test_json_image_large_object")
+{
+    json j;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        j[std::string("key") + std::to_string(i)] = i;
+    }
+    std::vector<uint8_t> data;
+    encode_json_image(j, data);
+    json_image image(data);
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        CHECK(image[std::string("key") + std::to_string(i)].as<size_t>() == i);
+    }
+}
+
+TEST_CASE("test_json_image_relocation")
+{
+    json j;
+    j["bytes"] = json(byte_string({'H','e','l','l','o'}));
+    j["date"] = json("2019-07-01", semantic_tag::datetime);
+    j["array"] = json::array{1.5, -2, "three", false, null_type()};
+
+    std::vector<uint8_t> data;
+    encode_json_image(j, data);
+
+    SECTION("copy")
+    {
+        std::vector<uint8_t> copy(data.size() + 3);
+        std::copy(data.begin(), data.end(), copy.begin() + 3);
+        json_image image(copy.data() + 3, data.size());
+        CHECK(image["bytes"].as_byte_string_view() == byte_string_view(byte_string({'H','e','l','l','o'})));
+        CHECK(image["date"].tag() == semantic_tag::datetime);
+        CHECK(image.to_json() == j);
+    }
+
+    SECTION("mmap")
+    {
+        {
+            std::ofstream os("./output/json_image.img", std::ios::binary);
+            encode_json_image(j, os);
+        }
+        binary_mmap_source source("./output/json_image.img");
+        json_image image(source.data(), source.size());
+        CHECK(image["array"][2].as<std::string>() == "three");
+
+        std::string s1;
+        j.dump(s1);
+        std::ostringstream os;
+        json_compressed_stream_encoder encoder(os);
+        image.root().dump(encoder);
+        CHECK(os.str() == s1);
+    }
+    std::remove("./output/json_image.img");
+}
+
+TEST_CASE("test_json_image_errors")
+{
+    std::vector<uint8_t> data(8, 0);
+    CHECK_THROWS(json_image(data));
+
+    json j = json::array{1,2,3};
+    encode_json_image(j, data);
+    CHECK_THROWS(wjson_image(data));
+
+    data.resize(data.size() - 8);
+    json_image image(data);
+    CHECK(image[0].as<int>() == 1);
+    CHECK_THROWS(image[2]);
+
+    SECTION("corrupt count")
+    {
+        std::vector<uint8_t> buf;
+        encode_json_image(json(json::array{1,2,3}), buf);
+        uint64_t offset;
+        std::memcpy(&offset, buf.data() + 24, sizeof(uint64_t));
+        // count*16 wraps to 0
+        const uint64_t count = uint64_t(1) << 60;
+        std::memcpy(buf.data() + offset, &count, sizeof(uint64_t));
+        json_image corrupt(buf);
+        CHECK_THROWS(corrupt.root().array_range());
+        CHECK(corrupt[1].as<int>() == 2);
+        CHECK_THROWS(corrupt[1000]);
+    }
+
+    SECTION("cyclic offset")
+    {
+        std::vector<uint8_t> buf;
+        encode_json_image(json::parse("[[1]]"), buf);
+        uint64_t offset;
+        std::memcpy(&offset, buf.data() + 24, sizeof(uint64_t));
+        // The inner array's slot refers back to the outer array
+        std::memcpy(buf.data() + offset + 16, &offset, sizeof(uint64_t));
+        json_image corrupt(buf);
+        CHECK(corrupt[0].is_array());
+        CHECK_THROWS_WITH(corrupt[0][0], "Invalid json image");
+        CHECK_THROWS_WITH(corrupt.to_json(), "Invalid json image");
+    }
+
+    SECTION("byte order")
+    {
+        std::vector<uint8_t> buf;
+        encode_json_image(json(json::array{1,2,3}), buf);
+        std::swap(buf[14], buf[15]);
+        CHECK_THROWS_WITH(json_image(buf), "Json image has a different byte order");
+    }
+}
@@ -55,3 +55,50 @@ TEST_CASE("test_integer_limits")
     }
 }
 
+
+TEST_CASE("test_integer_boundaries_across_buffers")
+{
+    std::string input = "[0,-0,7,12345678,123456789012345678,1234567890123456789,"
+                        "9223372036854775807,-9223372036854775808,-9223372036854775809,"
+                        "18446744073709551615,18446744073709551616,99999999999999999999,"
+                        "123456789012345678901234567890,-12345678]";
+
+    for (size_t chunk_size = 1; chunk_size <= input.size(); ++chunk_size)
+    {
+        json_decoder<json> decoder;
+        json_parser parser;
+        std::error_code ec;
+        size_t offset = 0;
+        while (!parser.finished())
+        {
+            if (parser.source_exhausted() && offset < input.size())
+            {
+                size_t length = (std::min)(chunk_size, input.size() - offset);
+                parser.update(input.data() + offset, length);
+                offset += length;
+            }
+            parser.parse_some(decoder, ec);
+            REQUIRE_FALSE(ec);
+        }
+        json j = decoder.get_result();
+        REQUIRE(j.size() == 14);
+
+        CHECK(j[0].as<uint64_t>() == 0);
+        CHECK(j[1].as<int64_t>() == 0);
+        CHECK(j[2].as<uint64_t>() == 7);
+        CHECK(j[3].as<uint64_t>() == 12345678);
+        CHECK(j[4].as<uint64_t>() == 123456789012345678ULL);
+        CHECK(j[5].as<uint64_t>() == 1234567890123456789ULL);
+        CHECK(j[6].as<int64_t>() == (std::numeric_limits<int64_t>::max)());
+        CHECK(j[7].is_int64());
+        CHECK(j[7].as<int64_t>() == (std::numeric_limits<int64_t>::lowest)());
+        CHECK(j[8].tag() == semantic_tag::bigint);
+        CHECK(j[8].as<std::string>() == "-9223372036854775809");
+        CHECK(j[9].as<uint64_t>() == (std::numeric_limits<uint64_t>::max)());
+        CHECK(j[10].tag() == semantic_tag::bigint);
+        CHECK(j[10].as<std::string>() == "18446744073709551616");
+        CHECK(j[11].as<std::string>() == "99999999999999999999");
+        CHECK(j[12].as<std::string>() == "123456789012345678901234567890");
+        CHECK(j[13].as<int64_t>() == -12345678);
+    }
+}
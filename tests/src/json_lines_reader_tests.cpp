@@ -0,0 +1,199 @@
+// Copyright 2019 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_encoder.hpp>
+#include <jsoncons/json_lines_reader.hpp>
+#include <catch/catch.hpp>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::string make_lines(size_t count)
+    {
+        std::ostringstream os;
+        for (size_t i = 0; i < count; ++i)
+        {
+            os << "{\"id\":" << i << ",\"name\":\"record " << i << "\",\"values\":[1,2.5,null]}";
+            os << ((i % 3 == 0) ? "\r\n" : "\n");
+            if (i % 10 == 0)
+            {
+                os << "   \n";
+            }
+        }
+        return os.str();
+    }
+
+    // Throws std::bad_alloc for allocations of more than 256 bytes
+    template <class T>
+    struct bounded_allocator
+    {
+        typedef T value_type;
+
+        bounded_allocator() = default;
+
+        template <class U>
+        bounded_allocator(const bounded_allocator<U>&) noexcept
+        {
+        }
+
+        T* allocate(size_t n)
+        {
+            if (n*sizeof(T) > 256)
+            {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(::operator new(n*sizeof(T)));
+        }
+
+        void deallocate(T* p, size_t)
+        {
+            ::operator delete(p);
+        }
+
+        friend bool operator==(const bounded_allocator&, const bounded_allocator&) noexcept
+        {
+            return true;
+        }
+
+        friend bool operator!=(const bounded_allocator&, const bounded_allocator&) noexcept
+        {
+            return false;
+        }
+    };
+}
+
+TEST_CASE("test_json_lines_reader_ordered")
+{
+    std::string input = make_lines(1000);
+
+    for (size_t num_threads : {1, 2, 4})
+    {
+        std::istringstream is(input);
+        json_lines_reader reader(is, json_lines_options().num_threads(num_threads).batch_size(7).max_pending_batches(3));
+
+        std::vector<json> values;
+        reader.read([&](json&& j){values.push_back(std::move(j));});
+
+        REQUIRE(values.size() == 1000);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            CHECK(values[i]["id"].as<size_t>() == i);
+        }
+    }
+}
+
+TEST_CASE("test_json_lines_reader_unordered")
+{
+    std::string input = make_lines(500);
+    std::istringstream is(input);
+    json_lines_reader reader(is, json_lines_options().num_threads(4).batch_size(5).ordered(false));
+
+    std::vector<size_t> ids;
+    reader.read([&](json&& j){ids.push_back(j["id"].as<size_t>());});
+
+    REQUIRE(ids.size() == 500);
+    std::sort(ids.begin(), ids.end());
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        CHECK(ids[i] == i);
+    }
+}
+
+TEST_CASE("test_json_lines_reader_errors")
+{
+    std::string input = "{\"a\":1}\n\n{\"a\":2,}\n[1,2]\n{\"a\" 3}\n\"last\"";
+
+    SECTION("on_error")
+    {
+        std::istringstream is(input);
+        json_lines_reader reader(is, json_lines_options().num_threads(2).batch_size(1));
+
+        std::vector<json> values;
+        std::vector<ser_error> errors;
+        reader.read([&](json&& j){values.push_back(std::move(j));},
+                    [&](const ser_error& e){errors.push_back(e);});
+
+        REQUIRE(values.size() == 3);
+        CHECK(values[0] == json::parse("{\"a\":1}"));
+        CHECK(values[1] == json::parse("[1,2]"));
+        CHECK(values[2] == json("last"));
+        REQUIRE(errors.size() == 2);
+        CHECK(errors[0].code() == json_errc::extra_comma);
+        CHECK(errors[0].line() == 3);
+        CHECK(errors[0].column() == 8);
+        CHECK(errors[1].code() == json_errc::expected_colon);
+        CHECK(errors[1].line() == 5);
+        CHECK(errors[1].column() == 6);
+    }
+
+    SECTION("throw")
+    {
+        std::istringstream is(input);
+        json_lines_reader reader(is, json_lines_options().num_threads(2).batch_size(1));
+
+        std::vector<json> values;
+        REQUIRE_THROWS_AS(reader.read([&](json&& j){values.push_back(std::move(j));}), ser_error);
+        CHECK(values.size() == 1);
+    }
+}
+
+TEST_CASE("test_json_lines_reader_handler")
+{
+    std::string input = "[1,2]\n{\"a\":true}\n";
+    std::istringstream is(input);
+    json_lines_reader reader(is, json_lines_options().num_threads(2));
+
+    std::ostringstream os;
+    json_compressed_stream_encoder encoder(os);
+    reader.read(encoder);
+    CHECK(os.str() == "[1,2]{\"a\":true}");
+}
+
+TEST_CASE("test_json_lines_reader_handler_errors")
+{
+    std::string input = "[1,2]\n{\"a\":}\n\"b\"\n";
+
+    std::istringstream is(input);
+    json_lines_reader reader(is, json_lines_options().num_threads(2).batch_size(2));
+
+    std::ostringstream os;
+    json_compressed_stream_encoder encoder(os);
+    std::vector<size_t> lines;
+    reader.read(encoder, [&](const ser_error& e){lines.push_back(e.line());});
+    CHECK(os.str() == "[1,2]\"b\"");
+    REQUIRE(lines.size() == 1);
+    CHECK(lines[0] == 2);
+}
+
+TEST_CASE("test_json_lines_reader_temporary_options")
+{
+    std::string input = "12345678901234567890123\n";
+    std::istringstream is(input);
+    json_lines_reader reader(is, json_lines_options().num_threads(2), json_options().lossless_number(true));
+
+    std::vector<json> values;
+    reader.read([&](json&& j){values.push_back(std::move(j));});
+    REQUIRE(values.size() == 1);
+    CHECK(values[0].as<std::string>() == "12345678901234567890123");
+}
+
+TEST_CASE("test_json_lines_reader_worker_exception")
+{
+    typedef basic_json<char,sorted_policy,bounded_allocator<char>> bounded_json;
+
+    std::string input = "1\n\"" + std::string(300, 'x') + "\"\n2\n";
+    std::istringstream is(input);
+    basic_json_lines_reader<bounded_json> reader(is, json_lines_options().num_threads(2).batch_size(1));
+
+    std::vector<int> values;
+    REQUIRE_THROWS_AS(reader.read([&](bounded_json&& j){values.push_back(j.as<int>());}), std::bad_alloc);
+    REQUIRE(values.size() == 1);
+    CHECK(values[0] == 1);
+}
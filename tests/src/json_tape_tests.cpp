@@ -0,0 +1,138 @@
+// Copyright 2019 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_encoder.hpp>
+#include <jsoncons/json_tape.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("test_json_tape_parse")
+{
+    std::string input = R"(
+{
+    "user" : {"id" : 12345, "name" : "Jane \"JJ\" Doe", "tags" : ["a","b","c"]},
+    "skipped" : [[1,2,{"x":[3,4]}], {"y":"}]"}],
+    "score" : 1.5e2,
+    "active" : true,
+    "none" : null,
+    "big" : 18446744073709551615,
+    "negative" : -7,
+    "empty" : {}
+}
+)";
+    json_tape tape = json_tape::parse(input);
+
+    CHECK(tape["user"]["id"].as<int64_t>() == 12345);
+    CHECK(tape["user"]["id"].is_uint64());
+    CHECK(tape["user"]["name"].as<std::string>() == "Jane \"JJ\" Doe");
+    CHECK(tape["user"]["name"].as<string_view>() == string_view("Jane \"JJ\" Doe"));
+    CHECK(tape["user"]["tags"][2].as<std::string>() == "c");
+    CHECK(tape["user"]["tags"].size() == 3);
+    CHECK(tape["score"].as<double>() == 150.0);
+    CHECK(tape["score"].as<int>() == 150);
+    CHECK(tape["active"].as<bool>());
+    CHECK(tape["none"].is_null());
+    CHECK(tape["big"].as<uint64_t>() == 18446744073709551615ULL);
+    CHECK(tape["negative"].is_int64());
+    CHECK(tape["negative"].as<int>() == -7);
+    CHECK(tape["empty"].is_object());
+    CHECK(tape["empty"].empty());
+    CHECK(tape.root().size() == 8);
+    CHECK(tape["skipped"][1]["y"].as<std::string>() == "}]");
+
+    CHECK(tape.root().contains("skipped"));
+    CHECK_FALSE(tape.root().contains("missing"));
+    CHECK_THROWS_AS(tape["missing"], key_not_found);
+    CHECK_THROWS_AS(tape["user"]["tags"][3], std::out_of_range);
+    CHECK_THROWS_AS(tape["user"]["id"]["x"], not_an_object);
+
+    CHECK(tape.to_json() == json::parse(input));
+}
+
+TEST_CASE("test_json_tape_ranges")
+{
+    json_tape tape = json_tape::parse(R"({"first":[10,[20,21],30],"second":{"x":1,"yA":2}})");
+
+    std::vector<json> items;
+    for (const auto& item : tape["first"].array_range())
+    {
+        items.push_back(item.to_json());
+    }
+    REQUIRE(items.size() == 3);
+    CHECK(items[0] == json(10));
+    CHECK(items[1] == json::parse("[20,21]"));
+    CHECK(items[2] == json(30));
+
+    std::vector<std::string> keys;
+    int64_t sum = 0;
+    for (const auto& member : tape["second"].object_range())
+    {
+        keys.push_back(std::string(member.key().data(), member.key().length()));
+        sum += member.value().as<int64_t>();
+    }
+    REQUIRE(keys.size() == 2);
+    CHECK(keys[0] == "x");
+    CHECK(keys[1] == "yA");
+    CHECK(sum == 3);
+}
+
+TEST_CASE("test_json_tape_from_json")
+{
+    json j;
+    j["bytes"] = json(byte_string({'H','e','l','l','o'}));
+    j["date"] = json("2019-07-01", semantic_tag::datetime);
+    j["array"] = json::array{1.5, -2, "three", false, null_type()};
+    j["object"] = json::object{{"nested", json::array()}};
+
+    json_tape tape = json_tape::from_json(j);
+
+    CHECK(tape["bytes"].is_byte_string());
+    CHECK(tape["bytes"].as_byte_string_view() == byte_string_view(byte_string({'H','e','l','l','o'})));
+    CHECK(tape["date"].tag() == semantic_tag::datetime);
+    CHECK(tape["array"][3].is_bool());
+    CHECK(tape["object"]["nested"].empty());
+
+    json j2 = tape.to_json();
+    CHECK(j2 == j);
+    CHECK(j2["date"].tag() == semantic_tag::datetime);
+
+    std::string s1;
+    j.dump(s1);
+    std::ostringstream os;
+    json_compressed_stream_encoder encoder(os);
+    tape.dump(encoder);
+    CHECK(os.str() == s1);
+
+    ojson oj = ojson::parse(R"({"b":1,"a":2})");
+    CHECK(json_tape::from_json(oj).to_json<ojson>() == oj);
+}
+
+TEST_CASE("test_json_tape_builder")
+{
+    json_tape_builder builder;
+    json_parser parser;
+    std::string input = R"([1,"two",{"three":3}])";
+    parser.update(input.data(), input.size());
+    parser.parse_some(builder);
+    parser.finish_parse(builder);
+    REQUIRE(builder.is_valid());
+    json_tape tape = builder.get_result();
+
+    // '[', 1, "two", '{', "three", 3, '}', ']' with two words for numbers and strings
+    CHECK(tape.tape_size() == 12);
+    CHECK(tape.string_arena_size() == 8);
+    CHECK(tape[2]["three"].as<int>() == 3);
+
+    json_tape scalar = json_tape::parse("\"text\"");
+    CHECK(scalar.root().as<std::string>() == "text");
+
+    wjson_tape wtape = wjson_tape::parse(L"{\"w\":[\"wide\"]}");
+    CHECK(wtape[L"w"][0].as<std::wstring>() == L"wide");
+
+    CHECK_THROWS_AS(json_tape::parse("[1,2"), ser_error);
+}
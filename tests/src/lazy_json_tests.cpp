@@ -0,0 +1,170 @@
+// Copyright 2019 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/lazy_json.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("test_lazy_json_lookup")
+{
+    std::string input = R"(
+{
+    "user" : {"id" : 12345, "name" : "Jane \"JJ\" Doe", "tags" : ["a","b","c"]},
+    "skipped" : [[1,2,{"x":[3,4]}], {"y":"}]"}],
+    "score" : 1.5e2,
+    "active" : true,
+    "none" : null,
+    "big" : 18446744073709551615,
+    "negative" : -7,
+    "empty" : {}
+}
+)";
+    lazy_json_document doc(input);
+
+    CHECK(doc["user"]["id"].as<int64_t>() == 12345);
+    CHECK(doc["user"]["id"].as<int>() == 12345);
+    CHECK(doc["user"]["name"].as<std::string>() == "Jane \"JJ\" Doe");
+    CHECK(doc["user"]["tags"][2].as<std::string>() == "c");
+    CHECK(doc["user"]["tags"][0].as<string_view>() == string_view("a"));
+    CHECK(doc["user"]["tags"].size() == 3);
+    CHECK(doc["score"].as<double>() == 150.0);
+    CHECK(doc["active"].as<bool>());
+    CHECK(doc["none"].is_null());
+    CHECK(doc["big"].is_uint64());
+    CHECK_FALSE(doc["big"].is_int64());
+    CHECK(doc["big"].as<uint64_t>() == 18446744073709551615ULL);
+    CHECK(doc["negative"].as<int64_t>() == -7);
+    CHECK(doc["negative"].is_int64());
+    CHECK_FALSE(doc["negative"].is_uint64());
+    CHECK(doc["score"].is_double());
+    CHECK(doc["empty"].is_object());
+    CHECK(doc["empty"].empty());
+    CHECK(doc.root().size() == 8);
+
+    CHECK(doc.root().contains("skipped"));
+    CHECK_FALSE(doc.root().contains("missing"));
+    CHECK(doc["skipped"][1]["y"].as<std::string>() == "}]");
+
+    CHECK_THROWS_AS(doc["missing"], key_not_found);
+    CHECK_THROWS_AS(doc["user"]["tags"][3], std::out_of_range);
+    CHECK_THROWS_AS(doc["user"]["id"]["x"], not_an_object);
+    CHECK_THROWS(doc["user"]["name"].as<string_view>());
+}
+
+TEST_CASE("test_lazy_json_to_json")
+{
+    std::string input = R"({"a":[1,2.5,"three",{"b":null}],"c":{"d":true}})";
+    lazy_json_document doc(input);
+
+    CHECK(doc["a"].to_json() == json::parse(R"([1,2.5,"three",{"b":null}])"));
+    CHECK(doc.root().to_json() == json::parse(input));
+    CHECK(doc["c"].as<json>() == json::parse(R"({"d":true})"));
+    CHECK(doc["a"].as<std::vector<json>>().size() == 4);
+    CHECK(doc["c"].text() == string_view(R"({"d":true})"));
+}
+
+TEST_CASE("test_lazy_json_ranges")
+{
+    std::string input = R"({"first":[10,[20,21],30],"second":{"x":1,"yA":2}})";
+    lazy_json_document doc(input);
+
+    std::vector<std::string> texts;
+    for (const auto& item : doc["first"].array_range())
+    {
+        texts.push_back(std::string(item.text().data(), item.text().length()));
+    }
+    REQUIRE(texts.size() == 3);
+    CHECK(texts[0] == "10");
+    CHECK(texts[1] == "[20,21]");
+    CHECK(texts[2] == "30");
+
+    std::vector<std::string> keys;
+    int64_t sum = 0;
+    for (const auto& member : doc["second"].object_range())
+    {
+        keys.push_back(member.key());
+        sum += member.value().as<int64_t>();
+    }
+    REQUIRE(keys.size() == 2);
+    CHECK(keys[0] == "x");
+    CHECK(keys[1] == "yA");
+    CHECK(sum == 3);
+    CHECK(doc["second"]["yA"].as<int>() == 2);
+}
+
+TEST_CASE("test_lazy_json_scalar_root")
+{
+    std::string text = "  42  ";
+    lazy_json_document doc1(text);
+    CHECK(doc1.as<int>() == 42);
+
+    std::wstring input = L"{\"w\":[\"wide\"]}";
+    wlazy_json_document doc2(input);
+    CHECK(doc2[L"w"][0].as<std::wstring>() == L"wide");
+}
+
+TEST_CASE("test_lazy_json_errors")
+{
+    struct test_case
+    {
+        std::string input;
+        std::error_code ec;
+        size_t line;
+        size_t column;
+    };
+    std::vector<test_case> cases = {
+        {"{\"a\":1,}", json_errc::extra_comma, 1, 8},
+        {"{\"a\" 1}", json_errc::expected_colon, 1, 6},
+        {"[1,2", json_errc::unexpected_eof, 1, 5},
+        {"[1,\n2]]", json_errc::extra_character, 2, 3},
+        {"[01]", json_errc::leading_zero, 1, 3},
+        {"[tru]", json_errc::invalid_value, 1, 5},
+        {"{1:2}", json_errc::expected_name, 1, 2},
+        {"[1}", json_errc::unexpected_right_brace, 1, 3}
+    };
+    for (const auto& c : cases)
+    {
+        try
+        {
+            lazy_json_document doc(c.input);
+            CHECK(false);
+        }
+        catch (const ser_error& e)
+        {
+            CHECK(e.code() == c.ec);
+            CHECK(e.line() == c.line);
+            CHECK(e.column() == c.column);
+        }
+    }
+
+    // Escapes are checked when the string is converted
+    std::string input = "{\"a\":1,\n\"b\":\"x\\qy\"}";
+    lazy_json_document doc(input);
+    CHECK(doc["a"].as<int>() == 1);
+    try
+    {
+        doc["b"].as<std::string>();
+        CHECK(false);
+    }
+    catch (const ser_error& e)
+    {
+        CHECK(e.code() == json_errc::illegal_escaped_character);
+        CHECK(e.line() == 2);
+    }
+}
+
+TEST_CASE("test_lazy_json_temporary_options")
+{
+    std::string input = R"({"a":12345678901234567890123})";
+    lazy_json_document doc(input, json_options().lossless_number(true));
+    json j = doc["a"].to_json();
+    CHECK(j.as<std::string>() == "12345678901234567890123");
+
+    CHECK_FALSE(std::is_move_constructible<lazy_json_document>::value);
+}
@@ -0,0 +1,157 @@
+// Copyright 2019 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_cursor.hpp>
+#include <jsoncons/mmap_source.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <jsoncons_ext/msgpack/msgpack.hpp>
+#include <jsoncons_ext/csv/csv.hpp>
+#include <catch/catch.hpp>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    template <class Container>
+    void write_file(const std::string& path, const Container& data)
+    {
+        std::ofstream os(path, std::ios::binary);
+        os.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+
+    json make_document()
+    {
+        json doc = json::array();
+        for (size_t i = 0; i < 2000; ++i)
+        {
+            json record;
+            record["id"] = i;
+            record["name"] = std::string("name \"") + std::to_string(i) + "\" with an escape \\n";
+            record["value"] = static_cast<double>(i) / 8.0;
+            doc.push_back(std::move(record));
+        }
+        return doc;
+    }
+}
+
+TEST_CASE("test_is_contiguous_source")
+{
+    CHECK(is_contiguous_source<mmap_source>::value);
+    CHECK(is_contiguous_source<string_source<char>>::value);
+    CHECK_FALSE(is_contiguous_source<stream_source<char>>::value);
+}
+
+TEST_CASE("test_mmap_source_json")
+{
+    json expected = make_document();
+    std::string text = expected.to_string();
+    REQUIRE(text.size() > 16384);
+    write_file("./output/mmap_source.json", text);
+
+    SECTION("json_reader")
+    {
+        json_decoder<json> decoder;
+        basic_json_reader<char,mmap_source> reader(mmap_source("./output/mmap_source.json"), decoder);
+        reader.read();
+        CHECK(decoder.get_result() == expected);
+    }
+
+    SECTION("json_cursor")
+    {
+        basic_json_cursor<char,mmap_source> cursor(mmap_source("./output/mmap_source.json"));
+        size_t count = 0;
+        for (; !cursor.done(); cursor.next())
+        {
+            if (cursor.current().event_type() == staj_event_type::begin_object)
+            {
+                ++count;
+            }
+        }
+        CHECK(count == expected.size());
+    }
+
+    std::remove("./output/mmap_source.json");
+}
+
+TEST_CASE("test_mmap_source_csv")
+{
+    std::string text = "a,b\n1,x\n2,y\n";
+    write_file("./output/mmap_source.csv", text);
+
+    json_decoder<json> decoder;
+    csv::csv_options options;
+    options.assume_header(true);
+    csv::basic_csv_reader<char,mmap_source> reader(mmap_source("./output/mmap_source.csv"), decoder, options);
+    reader.read();
+    json j = decoder.get_result();
+    REQUIRE(j.size() == 2);
+    CHECK(j[1]["b"].as<std::string>() == "y");
+
+    std::remove("./output/mmap_source.csv");
+}
+
+TEST_CASE("test_mmap_source_binary")
+{
+    json expected = make_document();
+
+    SECTION("cbor")
+    {
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(expected, data);
+        write_file("./output/mmap_source.cbor", data);
+
+        json_decoder<json> decoder;
+        cbor::json_to_cbor_content_handler_adaptor<> adaptor(decoder);
+        cbor::basic_cbor_reader<binary_mmap_source> reader(binary_mmap_source("./output/mmap_source.cbor"), adaptor);
+        reader.read();
+        CHECK(decoder.get_result() == expected);
+
+        std::remove("./output/mmap_source.cbor");
+    }
+
+    SECTION("msgpack")
+    {
+        std::vector<uint8_t> data;
+        msgpack::encode_msgpack(expected, data);
+        write_file("./output/mmap_source.msgpack", data);
+
+        json_decoder<json> decoder;
+        msgpack::basic_msgpack_reader<binary_mmap_source> reader(binary_mmap_source("./output/mmap_source.msgpack"), decoder);
+        reader.read();
+        CHECK(decoder.get_result() == expected);
+
+        std::remove("./output/mmap_source.msgpack");
+    }
+}
+
+TEST_CASE("test_mmap_source_errors")
+{
+    SECTION("missing file")
+    {
+        mmap_source source("./output/does_not_exist.json");
+        CHECK(source.is_error());
+        CHECK(source.error());
+
+        json_decoder<json> decoder;
+        basic_json_reader<char,mmap_source> reader(std::move(source), decoder);
+        std::error_code ec;
+        reader.read(ec);
+        CHECK(ec == json_errc::source_error);
+    }
+
+    SECTION("empty file")
+    {
+        write_file("./output/mmap_source_empty.json", std::string());
+        mmap_source source("./output/mmap_source_empty.json");
+        CHECK_FALSE(source.is_error());
+        CHECK(source.eof());
+        CHECK(source.size() == 0);
+        std::remove("./output/mmap_source_empty.json");
+    }
+}
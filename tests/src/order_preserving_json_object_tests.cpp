@@ -410,3 +410,76 @@ TEST_CASE("order preserving erase")
     }
 }
   
+
+TEST_CASE("order preserving incremental index")
+{
+    json_object<std::string, ojson> o;
+    o.insert_or_assign("b", ojson(1));
+    o.insert_or_assign("a", ojson(2));
+
+    typedef std::pair<ojson::key_type,ojson> item_type;
+    std::vector<item_type> items;
+    items.emplace_back("c", 3);
+    items.emplace_back("a", 4);
+    items.emplace_back("e", 5);
+    items.emplace_back("c", 6);
+    items.emplace_back("d", 7);
+
+    o.insert(std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()), 
+             [](item_type&& item){return ojson::key_value_type(std::forward<ojson::key_type>(item.first),std::forward<ojson>(item.second));});
+
+    SECTION("insert keeps the first of duplicate keys")
+    {
+        REQUIRE(o.size() == 5);
+        std::vector<std::pair<std::string,int>> expected = {{"b",1},{"a",2},{"c",3},{"e",5},{"d",7}};
+        size_t i = 0;
+        for (const auto& member : o)
+        {
+            CHECK(member.key() == expected[i].first);
+            CHECK(member.value().as<int>() == expected[i].second);
+            CHECK(o.find(expected[i].first)->value().as<int>() == expected[i].second);
+            ++i;
+        }
+    }
+
+    SECTION("swap")
+    {
+        json_object<std::string, ojson> other;
+        other.insert_or_assign("z", ojson(26));
+        o.swap(other);
+        REQUIRE(o.size() == 1);
+        CHECK(o.find("z")->value().as<int>() == 26);
+        CHECK(bool(o.find("a") == o.end()));
+        CHECK(other.find("d")->value().as<int>() == 7);
+    }
+
+    SECTION("erase and insert in the middle")
+    {
+        const size_t n = 1000;
+        json_object<std::string, ojson> big;
+        for (size_t i = 0; i < n; ++i)
+        {
+            big.try_emplace(std::to_string(i), i);
+        }
+        big.erase(big.begin() + 100, big.begin() + 200);
+        big.erase("500");
+        big.insert_or_assign(big.begin() + 10, "inserted", ojson(-1));
+        REQUIRE(big.size() == n - 100);
+        CHECK(big.at(10).as<int>() == -1);
+        CHECK(big.at(11).as<size_t>() == 10);
+        for (size_t i = 0; i < n; ++i)
+        {
+            auto it = big.find(std::to_string(i));
+            if ((i >= 100 && i < 200) || i == 500)
+            {
+                CHECK(bool(it == big.end()));
+            }
+            else
+            {
+                REQUIRE(bool(it != big.end()));
+                CHECK(it->value().as<size_t>() == i);
+            }
+        }
+        CHECK(big.find("inserted")->value().as<int>() == -1);
+    }
+}
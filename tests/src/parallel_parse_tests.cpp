@@ -0,0 +1,143 @@
+// Copyright 2019 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/parallel_parse.hpp>
+#include <catch/catch.hpp>
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::string make_records(size_t count)
+    {
+        std::ostringstream os;
+        os << "[\n";
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (i > 0)
+            {
+                os << ",\r\n";
+            }
+            os << "  {\"id\":" << i << ", \"name\":\"a, \\\"b\\\" [c] {d}\", \"values\":[" << i << ".5,-" << i
+               << ",true,null], /* comment, ] */ \"nested\":{\"x\":[[],{}]}}";
+        }
+        os << "\n]\n";
+        return os.str();
+    }
+
+    void check_same_error(const std::string& input, size_t max_chunks)
+    {
+        size_t line = 0;
+        size_t column = 0;
+        std::error_code ec;
+        try
+        {
+            json::parse(input);
+        }
+        catch (const ser_error& e)
+        {
+            line = e.line();
+            column = e.column();
+            ec = e.code();
+        }
+        REQUIRE(ec);
+
+        try
+        {
+            parallel_parse<json>(string_view(input), max_chunks);
+            CHECK(false);
+        }
+        catch (const ser_error& e)
+        {
+            CHECK(e.code() == ec);
+            CHECK(e.line() == line);
+            CHECK(e.column() == column);
+        }
+    }
+}
+
+TEST_CASE("test_split_json_array")
+{
+    std::string input = make_records(50);
+
+    SECTION("chunks cover the input")
+    {
+        auto chunks = split_json_array(string_view(input), 4);
+        REQUIRE(chunks.size() == 4);
+        CHECK(chunks.front().first);
+        CHECK(chunks.back().last);
+        CHECK(chunks.front().text.data() == input.data());
+        CHECK(chunks.back().text.data() + chunks.back().text.size() == input.data() + input.size());
+        for (size_t i = 1; i < chunks.size(); ++i)
+        {
+            CHECK_FALSE(chunks[i].first);
+            CHECK(*(chunks[i].text.data() - 1) == ',');
+            CHECK(chunks[i].line == 1 + static_cast<size_t>(std::count(input.c_str(), chunks[i].text.data(), '\n')));
+        }
+    }
+
+    SECTION("not an array")
+    {
+        std::string s = R"({"a":[1,2,3]})";
+        auto chunks = split_json_array(string_view(s), 4);
+        REQUIRE(chunks.size() == 1);
+        CHECK(chunks[0].first);
+        CHECK(chunks[0].last);
+    }
+}
+
+TEST_CASE("test_parallel_parse")
+{
+    std::string input = make_records(200);
+    json expected = json::parse(input);
+
+    for (size_t max_chunks = 1; max_chunks <= 9; ++max_chunks)
+    {
+        json j = parallel_parse<json>(string_view(input), max_chunks);
+        CHECK(j == expected);
+    }
+
+    CHECK(parallel_parse<json>(string_view("[]"), 4) == json::parse("[]"));
+    CHECK(parallel_parse<json>(string_view(" [1] "), 4) == json::parse("[1]"));
+    CHECK(parallel_parse<ojson>(string_view(input), 3) == ojson::parse(input));
+    CHECK(parallel_parse<json>(string_view(input)) == expected);
+}
+
+TEST_CASE("test_parallel_parse_missing_element")
+{
+    for (size_t max_chunks = 2; max_chunks <= 6; ++max_chunks)
+    {
+        check_same_error("[1,2,]", max_chunks);
+        check_same_error("[1,,2]", max_chunks);
+        check_same_error("[1, ,2,3,4,5]", max_chunks);
+        check_same_error("[1,2,3,4, \n]", max_chunks);
+    }
+
+    std::string input = make_records(100);
+    input.insert(input.rfind(']'), ",");
+    check_same_error(input, 4);
+}
+
+TEST_CASE("test_parallel_parse_error_position")
+{
+    std::string input = make_records(100);
+
+    std::vector<std::string> bad_values = {"tru", "1.e5", "\"abc", "{\"a\" 1}", "[1,,2]"};
+    for (size_t pos : {input.size() / 10, input.size() / 2, input.size() - input.size() / 10})
+    {
+        size_t p = input.find("null", pos);
+        REQUIRE(p != std::string::npos);
+        for (const auto& bad : bad_values)
+        {
+            std::string s = input;
+            s.replace(p, 4, bad);
+            check_same_error(s, 4);
+            check_same_error(s, 7);
+        }
+    }
+}
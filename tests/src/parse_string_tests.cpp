@@ -130,3 +130,173 @@ TEST_CASE("test_parse_big_string2")
 }
 
 
+
+TEST_CASE("test_parse_string_special_at_each_offset")
+{
+    for (size_t i = 0; i < 80; ++i)
+    {
+        std::string content(i, 'a');
+
+        SECTION("escaped quote")
+        {
+            std::string input = "\"" + content + "\\\"" + content + "\"";
+            json j = json::parse(input);
+            CHECK(j.as<std::string>() == content + "\"" + content);
+        }
+
+        SECTION("escaped codepoints")
+        {
+            std::string input = "\"" + content + "\\u00e9\\uD834\\uDD1E" + content + "\"";
+            json j = json::parse(input);
+            CHECK(j.as<std::string>() == content + "\xC3\xA9\xF0\x9D\x84\x9E" + content);
+        }
+
+        SECTION("illegal control character")
+        {
+            std::string input = "\"" + content + "\x01" + content + "\"";
+            std::error_code ec;
+            size_t column = 0;
+            JSONCONS_TRY
+            {
+                json::parse(input);
+            }
+            JSONCONS_CATCH (const ser_error& e)
+            {
+                ec = e.code();
+                column = e.column();
+            }
+            CHECK(ec == json_errc::illegal_control_character);
+            CHECK(column == i + 3);
+        }
+
+        SECTION("illegal escaped character")
+        {
+            std::string input = "\"" + content + "\\q" + content + "\"";
+            std::error_code ec;
+            size_t column = 0;
+            JSONCONS_TRY
+            {
+                json::parse(input);
+            }
+            JSONCONS_CATCH (const ser_error& e)
+            {
+                ec = e.code();
+                column = e.column();
+            }
+            CHECK(ec == json_errc::illegal_escaped_character);
+            CHECK(column == i + 3);
+        }
+    }
+}
+
+TEST_CASE("test_parse_string_codepoint_across_buffers")
+{
+    std::string input = "[\"abc\\u00e9\\uD834\\uDD1Edef\", \"\\u00ZZ\"]";
+
+    for (size_t i = 1; i < 30; ++i)
+    {
+        std::istringstream is(input);
+        json_decoder<json> decoder;
+        json_reader reader(is, decoder);
+        reader.buffer_length(i);
+        std::error_code ec;
+        reader.read(ec);
+        CHECK(ec == json_errc::expected_value);
+    }
+
+    std::string valid = "[\"abc\\u00e9\\uD834\\uDD1Edef\"]";
+    for (size_t i = 1; i < 30; ++i)
+    {
+        std::istringstream is(valid);
+        json_decoder<json> decoder;
+        json_reader reader(is, decoder);
+        reader.buffer_length(i);
+        reader.read();
+        CHECK(decoder.get_result()[0].as<std::string>() == "abc\xC3\xA9\xF0\x9D\x84\x9E" "def");
+    }
+}
+
+namespace {
+
+    class insitu_check_filter : public json_filter
+    {
+        const char* first_;
+        const char* last_;
+    public:
+        size_t borrowed = 0;
+        size_t copied = 0;
+
+        insitu_check_filter(json_content_handler& handler, const char* first, const char* last)
+            : json_filter(handler), first_(first), last_(last)
+        {
+        }
+    private:
+        void check(const string_view_type& s)
+        {
+            if (s.data() >= first_ && s.data() + s.length() <= last_)
+            {
+                ++borrowed;
+            }
+            else
+            {
+                ++copied;
+            }
+        }
+
+        bool do_name(const string_view_type& name, const ser_context& context) override
+        {
+            check(name);
+            return to_handler().name(name, context);
+        }
+
+        bool do_string_value(const string_view_type& s, semantic_tag tag, const ser_context& context) override
+        {
+            check(s);
+            return to_handler().string_value(s, tag, context);
+        }
+    };
+}
+
+TEST_CASE("test_parse_string_insitu")
+{
+    std::string input = R"({"plain":"abc","esc\"aped":"a\nb\t\\\/é𝄞 end","empty":"","last":"\"x\""})";
+    json expected = json::parse(input);
+
+    SECTION("one buffer")
+    {
+        std::vector<char> buffer(input.begin(), input.end());
+
+        json_decoder<json> decoder;
+        insitu_check_filter filter(decoder, buffer.data(), buffer.data() + buffer.size());
+        json_parser parser;
+        parser.update_insitu(buffer.data(), buffer.size());
+        parser.parse_some(filter);
+        parser.finish_parse(filter);
+        parser.check_done();
+
+        CHECK(decoder.get_result() == expected);
+        CHECK(filter.borrowed == 8);
+        CHECK(filter.copied == 0);
+        CHECK(std::string(buffer.data(), buffer.size()).find("a\nb\t\\/\xC3\xA9\xF0\x9D\x84\x9E end") != std::string::npos);
+    }
+
+    SECTION("split buffers")
+    {
+        for (size_t split = 1; split < input.size(); ++split)
+        {
+            std::vector<char> buffer1(input.begin(), input.begin() + split);
+            std::vector<char> buffer2(input.begin() + split, input.end());
+
+            json_decoder<json> decoder;
+            json_parser parser;
+            parser.update_insitu(buffer1.data(), buffer1.size());
+            parser.parse_some(decoder);
+            std::fill(buffer1.begin(), buffer1.end(), '?'); // the parser must not refer back to it
+            parser.update_insitu(buffer2.data(), buffer2.size());
+            parser.parse_some(decoder);
+            parser.finish_parse(decoder);
+
+            CHECK(decoder.get_result() == expected);
+        }
+    }
+}
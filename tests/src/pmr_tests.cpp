@@ -0,0 +1,106 @@
+// Copyright 2019 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/pmr.hpp>
+#include <catch/catch.hpp>
+#include <string>
+
+#if defined(JSONCONS_HAS_POLYMORPHIC_ALLOCATOR)
+
+using namespace jsoncons;
+
+namespace {
+
+    class counting_resource : public std::pmr::memory_resource
+    {
+    public:
+        size_t allocations = 0;
+        size_t deallocations = 0;
+        size_t outstanding = 0;
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            ++allocations;
+            outstanding += bytes;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override
+        {
+            ++deallocations;
+            outstanding -= bytes;
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+}
+
+TEST_CASE("test_pmr_json")
+{
+    counting_resource resource;
+    pmr::polymorphic_allocator<char> alloc(&resource);
+
+    pmr::json j(alloc);
+    j.try_emplace("a string that is long enough to allocate", "a value that is long enough to allocate");
+    j.try_emplace("array", pmr::json::make_array(0, alloc));
+    j["array"].push_back(1);
+    CHECK(resource.allocations > 0);
+    CHECK(j["array"].get_allocator().resource() == &resource);
+
+    pmr::json copy(j);
+    CHECK(copy.get_allocator().resource() == &resource);
+    CHECK(copy == j);
+
+    size_t before = resource.outstanding;
+    {
+        pmr::json other(j);
+    }
+    CHECK(resource.outstanding == before);
+}
+
+TEST_CASE("test_pmr_json_arena")
+{
+    counting_resource upstream;
+    std::string input = R"(
+[
+    {"id":1,"name":"A name that does not fit in a short string","tags":["x","y"]},
+    {"id":2,"name":"Another name that does not fit in a short string","tags":[]}
+]
+)";
+
+    {
+        pmr::json_arena arena(1024, &upstream);
+        CHECK(arena.root().is_null());
+
+        arena.parse(input);
+        CHECK(arena->size() == 2);
+        CHECK(arena.root()[1]["name"].as<std::string>() == "Another name that does not fit in a short string");
+        CHECK(arena.root()[0]["tags"][1].as<std::string>() == "y");
+        CHECK(arena.root()[0]["tags"].get_allocator() == arena.get_allocator());
+        CHECK(arena.root().to_string() == json::parse(input).to_string());
+        CHECK(upstream.outstanding > 0);
+
+        // Values are released with the arena, not one by one
+        size_t deallocations = upstream.deallocations;
+        arena.parse(R"({"b":2,"a":1})");
+        CHECK(upstream.deallocations > deallocations);
+        CHECK(arena.root().to_string() == R"({"a":1,"b":2})");
+
+        arena.clear();
+        CHECK(arena.root().is_null());
+        CHECK(upstream.outstanding == 0);
+
+        CHECK_THROWS_AS(arena.parse("[1,2"), ser_error);
+        CHECK(arena.root().is_null());
+    }
+    CHECK(upstream.outstanding == 0);
+
+    pmr::ojson_arena oarena;
+    oarena.parse(R"({"b":2,"a":1})");
+    CHECK(oarena.root().to_string() == R"({"b":2,"a":1})");
+}
+
+#endif
@@ -0,0 +1,170 @@
+// Copyright 2019 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/read_ahead_source.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <catch/catch.hpp>
+#include <cstring>
+#include <stdexcept>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    // Returns one chunk and then throws
+    class throwing_source
+    {
+        bool first_;
+    public:
+        typedef char value_type;
+        typedef std::char_traits<char> traits_type;
+
+        throwing_source()
+            : first_(true)
+        {
+        }
+
+        bool eof() const
+        {
+            return false;
+        }
+
+        bool is_error() const
+        {
+            return false;
+        }
+
+        size_t read(char* p, size_t length)
+        {
+            if (!first_)
+            {
+                throw std::runtime_error("read failed");
+            }
+            first_ = false;
+            const std::string s = "[1,2,";
+            size_t len = s.size() < length ? s.size() : length;
+            std::memcpy(p, s.data(), len);
+            return len;
+        }
+    };
+
+    json make_document()
+    {
+        json doc = json::array();
+        for (size_t i = 0; i < 500; ++i)
+        {
+            json record;
+            record["id"] = i;
+            record["name"] = std::string("a longer name \"") + std::to_string(i) + "\"";
+            record["value"] = static_cast<double>(i) / 3.0;
+            doc.push_back(std::move(record));
+        }
+        return doc;
+    }
+}
+
+TEST_CASE("test_read_ahead_source_json")
+{
+    json expected = make_document();
+    std::string text = expected.to_string();
+
+    SECTION("default buffers")
+    {
+        std::istringstream is(text);
+        json_decoder<json> decoder;
+        basic_json_reader<char,read_ahead_source<stream_source<char>>> reader(is, decoder);
+        reader.read();
+        CHECK(decoder.get_result() == expected);
+    }
+
+    SECTION("small buffers")
+    {
+        for (size_t num_buffers : {2, 3, 8})
+        {
+            std::istringstream is(text);
+            json_decoder<json> decoder;
+            read_ahead_source<stream_source<char>> source(is, 97, num_buffers);
+            basic_json_reader<char,read_ahead_source<stream_source<char>>> reader(std::move(source), decoder);
+            reader.read();
+            CHECK(decoder.get_result() == expected);
+        }
+    }
+
+    SECTION("empty input")
+    {
+        std::istringstream is("");
+        json_decoder<json> decoder;
+        basic_json_reader<char,read_ahead_source<stream_source<char>>> reader(is, decoder);
+        std::error_code ec;
+        reader.read(ec);
+        CHECK(ec == json_errc::unexpected_eof);
+    }
+}
+
+TEST_CASE("test_read_ahead_source_binary")
+{
+    json expected = make_document();
+    std::vector<uint8_t> data;
+    cbor::encode_cbor(expected, data);
+    std::string bytes(data.begin(), data.end());
+
+    std::istringstream is(bytes);
+    json_decoder<json> decoder;
+    cbor::json_to_cbor_content_handler_adaptor<> adaptor(decoder);
+    read_ahead_source<binary_stream_source> source(is, 61, 3);
+    cbor::basic_cbor_reader<read_ahead_source<binary_stream_source>> reader(std::move(source), adaptor);
+    reader.read();
+    CHECK(decoder.get_result() == expected);
+}
+
+TEST_CASE("test_read_ahead_source_members")
+{
+    std::istringstream is("abcdefghij");
+    read_ahead_source<stream_source<char>> source(is, 3, 2);
+
+    CHECK(source.peek() == 'a');
+    CHECK(source.get() == 'a');
+    source.ignore(4);
+    CHECK(source.position() == 6);
+
+    char buf[3];
+    CHECK(source.read(buf, 3) == 3);
+    CHECK(std::string(buf, 3) == "fgh");
+    CHECK_FALSE(source.eof());
+
+    // Views do not extend past the end of a buffer
+    const char* p = nullptr;
+    CHECK(source.read_view(p, 10) == 1);
+    CHECK(*p == 'i');
+    CHECK(source.read_view(p, 10) == 1);
+    CHECK(*p == 'j');
+    CHECK(source.read_view(p, 10) == 0);
+    CHECK(source.eof());
+    CHECK_FALSE(source.is_error());
+}
+
+TEST_CASE("test_read_ahead_source_exception")
+{
+    SECTION("source")
+    {
+        read_ahead_source<throwing_source> source(throwing_source(), 16, 2);
+        char buf[16];
+        CHECK(source.read(buf, 5) == 5);
+        CHECK(std::string(buf, 5) == "[1,2,");
+        CHECK_THROWS_WITH(source.read(buf, 1), "read failed");
+        CHECK(source.eof());
+        CHECK(source.is_error());
+        CHECK(source.read(buf, 1) == 0);
+    }
+
+    SECTION("reader")
+    {
+        json_decoder<json> decoder;
+        basic_json_reader<char,read_ahead_source<throwing_source>> reader(throwing_source(), decoder);
+        CHECK_THROWS_WITH(reader.read(), "read failed");
+    }
+}
@@ -0,0 +1,537 @@
+// Copyright 2019 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <jsoncons_ext/msgpack/msgpack.hpp>
+#include <jsoncons_ext/bson/bson.hpp>
+#include <jsoncons_ext/ubjson/ubjson.hpp>
+#include <catch/catch.hpp>
+#include <array>
+#include <map>
+#include <unordered_map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace ser_traits_tests {
+
+    struct point
+    {
+        int x;
+        int y;
+    };
+
+    struct shape
+    {
+        std::string name;
+        std::vector<point> points;
+        std::map<std::string,double> attributes;
+        bool closed;
+    };
+
+    struct strict_point
+    {
+        int x;
+        int y;
+    };
+
+    struct named_point
+    {
+        int x;
+        int y;
+    };
+
+    class fixed_point
+    {
+        int x_;
+        int y_;
+    public:
+        fixed_point(int x, int y)
+            : x_(x), y_(y)
+        {
+        }
+
+        int x() const {return x_;}
+        int y() const {return y_;}
+    };
+
+    class segment
+    {
+        fixed_point from_;
+        fixed_point to_;
+        std::string label_;
+    public:
+        segment(const fixed_point& from, const fixed_point& to, const std::string& label)
+            : from_(from), to_(to), label_(label)
+        {
+        }
+
+        const fixed_point& from() const {return from_;}
+        const fixed_point& to() const {return to_;}
+        const std::string& label() const {return label_;}
+    };
+
+    class private_point
+    {
+        int x;
+        int y;
+
+        JSONCONS_TYPE_TRAITS_FRIEND;
+
+        private_point()
+            : x(0), y(0)
+        {
+        }
+    public:
+        int get_x() const {return x;}
+        int get_y() const {return y;}
+    };
+
+    class settable_point
+    {
+        int x_;
+        int y_;
+    public:
+        settable_point()
+            : x_(0), y_(0)
+        {
+        }
+
+        int get_x() const {return x_;}
+        void set_x(int x) {x_ = x;}
+        int get_y() const {return y_;}
+        void set_y(int y) {y_ = y;}
+    };
+
+    enum class color {red, green, blue};
+    enum class size {small, large};
+
+    struct item
+    {
+        color c;
+        size s;
+        std::vector<color> palette;
+    };
+
+    struct prefixes
+    {
+        int a;
+        int ab;
+        int abc;
+        int b;
+    };
+
+} // namespace ser_traits_tests
+
+JSONCONS_MEMBER_TRAITS_DECL(ser_traits_tests::point, x, y)
+JSONCONS_MEMBER_TRAITS_DECL(ser_traits_tests::shape, name, points, attributes, closed)
+JSONCONS_STRICT_MEMBER_TRAITS_DECL(ser_traits_tests::strict_point, x, y)
+JSONCONS_MEMBER_NAMED_TRAITS_DECL(ser_traits_tests::named_point, (x,"X"), (y,"Y"))
+JSONCONS_GETTER_CTOR_TRAITS_DECL(ser_traits_tests::fixed_point, x, y)
+JSONCONS_GETTER_CTOR_NAMED_TRAITS_DECL(ser_traits_tests::segment, (from,"From"), (to,"To"), (label,"Label"))
+JSONCONS_MEMBER_TRAITS_DECL(ser_traits_tests::private_point, x, y)
+JSONCONS_GETTER_SETTER_NAMED_TRAITS_DECL(ser_traits_tests::settable_point, (get_x,set_x,"x"), (get_y,set_y,"y"))
+JSONCONS_ENUM_TRAITS_DECL(ser_traits_tests::color, red, green, blue)
+JSONCONS_ENUM_NAMED_TRAITS_DECL(ser_traits_tests::size, (small,"S"), (large,"L"))
+JSONCONS_MEMBER_TRAITS_DECL(ser_traits_tests::item, c, s, palette)
+JSONCONS_MEMBER_TRAITS_DECL(ser_traits_tests::prefixes, a, ab, abc, b)
+
+using namespace ser_traits_tests;
+
+TEST_CASE("ser_traits decodes structs from a cursor")
+{
+    SECTION("nested structs, vectors and maps")
+    {
+        std::string s = R"(
+        {
+            "name" : "triangle",
+            "points" : [{"x":0,"y":0},{"y":4,"x":3},{"x":3,"y":0}],
+            "attributes" : {"weight":1.5,"depth":2},
+            "closed" : true
+        }
+        )";
+        shape val = decode_json<shape>(s);
+        CHECK(val.name == "triangle");
+        REQUIRE(val.points.size() == 3);
+        CHECK(val.points[1].x == 3);
+        CHECK(val.points[1].y == 4);
+        CHECK(val.attributes.size() == 2);
+        CHECK(val.attributes["weight"] == 1.5);
+        CHECK(val.attributes["depth"] == 2.0);
+        CHECK(val.closed);
+    }
+
+    SECTION("unknown members are skipped")
+    {
+        std::string s = R"({"z":{"a":[1,{"b":[]}],"c":{}},"x":1,"w":[[2],[3]],"y":2,"v":"3"})";
+        point val = decode_json<point>(s);
+        CHECK(val.x == 1);
+        CHECK(val.y == 2);
+
+        std::vector<point> v = decode_json<std::vector<point>>(std::string(R"([{"x":1,"z":[{"x":9}]},{"y":2}])"));
+        REQUIRE(v.size() == 2);
+        CHECK(v[0].x == 1);
+        CHECK(v[0].y == 0);
+        CHECK(v[1].x == 0);
+        CHECK(v[1].y == 2);
+    }
+
+    SECTION("missing members")
+    {
+        point val = decode_json<point>(std::string(R"({"y":2})"));
+        CHECK(val.x == 0);
+        CHECK(val.y == 2);
+
+        CHECK_THROWS_AS(decode_json<strict_point>(std::string(R"({"y":2})")), key_not_found);
+        strict_point sp = decode_json<strict_point>(std::string(R"({"y":2,"x":1})"));
+        CHECK(sp.x == 1);
+    }
+
+    SECTION("named members")
+    {
+        named_point val = decode_json<named_point>(std::string(R"({"Y":2,"X":1,"x":5})"));
+        CHECK(val.x == 1);
+        CHECK(val.y == 2);
+    }
+
+    SECTION("getter and constructor")
+    {
+        segment val = decode_json<segment>(std::string(R"({"Label":"a","To":{"x":3,"y":4},"From":{"y":2,"x":1}})"));
+        CHECK(val.from().x() == 1);
+        CHECK(val.from().y() == 2);
+        CHECK(val.to().x() == 3);
+        CHECK(val.to().y() == 4);
+        CHECK(val.label() == "a");
+
+        CHECK_THROWS_AS(decode_json<fixed_point>(std::string(R"({"x":1})")), key_not_found);
+    }
+
+    SECTION("private members")
+    {
+        private_point val = decode_json<private_point>(std::string(R"({"x":1,"y":2})"));
+        CHECK(val.get_x() == 1);
+        CHECK(val.get_y() == 2);
+    }
+
+    SECTION("getter and setter")
+    {
+        settable_point val = decode_json<settable_point>(std::string(R"({"x":1,"y":2})"));
+        CHECK(val.get_x() == 1);
+        CHECK(val.get_y() == 2);
+    }
+
+    SECTION("wide characters")
+    {
+        point val = decode_json<point>(std::wstring(LR"({"x":1,"y":2})"));
+        CHECK(val.x == 1);
+        CHECK(val.y == 2);
+    }
+
+    SECTION("parse error")
+    {
+        CHECK_THROWS_AS(decode_json<point>(std::string(R"({"x":1,"y":})")), ser_error);
+        CHECK_THROWS_AS(decode_json<fixed_point>(std::string(R"({"x":1,"y":})")), ser_error);
+    }
+}
+
+TEST_CASE("ser_traits decodes values as json does")
+{
+    SECTION("numbers and booleans from strings")
+    {
+        CHECK(decode_json<bool>(std::string("\"true\"")) == json("true").as<bool>());
+        CHECK(decode_json<bool>(std::string("\"true\"")));
+        CHECK(decode_json<int>(std::string("\"12\"")) == 12);
+        CHECK(decode_json<double>(std::string("\"1.5\"")) == 1.5);
+        CHECK(decode_json<std::vector<bool>>(std::string("[\"true\",false,1]")) == std::vector<bool>({true, false, true}));
+    }
+
+    SECTION("containers of the wrong type")
+    {
+        CHECK_THROWS_WITH(decode_json<shape>(std::string(R"({"points":5})")), "Attempt to cast json non-array to array");
+        CHECK_THROWS(decode_json<shape>(std::string(R"({"attributes":[1,2]})")));
+        CHECK_THROWS(json::parse(R"([1,2])").as<std::map<std::string,double>>());
+        CHECK_THROWS(decode_json<std::vector<int>>(std::string(R"({"a":1})")));
+
+        shape val;
+        val.points = {{1,2}};
+        CHECK_THROWS(decode_json_into(val, std::string(R"({"points":"a"})")));
+        std::array<int,2> arr = {{1,2}};
+        CHECK_THROWS(decode_json_into(arr, std::string("true")));
+    }
+
+    SECTION("the first of duplicate names is read")
+    {
+        std::string s = R"({"x":1,"y":2,"x":3,"attributes":{"a":1,"b":2,"a":3}})";
+        json j = json::parse(s);
+
+        point p = decode_json<point>(s);
+        CHECK(p.x == j["x"].as<int>());
+        CHECK(p.x == 1);
+
+        shape val = decode_json<shape>(std::string(R"({"name":"a","attributes":{"a":1,"b":2,"a":3},"name":"b"})"));
+        CHECK(val.name == "a");
+        CHECK(val.attributes.at("a") == j["attributes"]["a"].as<double>());
+        CHECK(val.attributes.at("a") == 1.0);
+
+        decode_json_into(val.attributes, std::string(R"({"b":4,"a":5,"b":6})"));
+        CHECK(val.attributes.size() == 2);
+        CHECK(val.attributes.at("a") == 5.0);
+        CHECK(val.attributes.at("b") == 4.0);
+
+        segment seg = decode_json<segment>(std::string(R"({"Label":"a","To":{"x":3,"y":4},"From":{"y":2,"x":1},"Label":"b"})"));
+        CHECK(seg.label() == "a");
+    }
+}
+
+TEST_CASE("ser_traits decodes structs from binary cursors")
+{
+    shape val;
+    val.name = "square";
+    val.points = {{0,0},{0,1},{1,1},{1,0}};
+    val.attributes["weight"] = 2.5;
+    val.closed = true;
+
+    auto check = [](const shape& result)
+    {
+        CHECK(result.name == "square");
+        REQUIRE(result.points.size() == 4);
+        CHECK(result.points[2].x == 1);
+        CHECK(result.points[2].y == 1);
+        CHECK(result.attributes.at("weight") == 2.5);
+        CHECK(result.closed);
+    };
+
+    SECTION("cbor")
+    {
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(val, data);
+        check(cbor::decode_cbor<shape>(data));
+    }
+
+    SECTION("msgpack")
+    {
+        std::vector<uint8_t> data;
+        msgpack::encode_msgpack(val, data);
+        check(msgpack::decode_msgpack<shape>(data));
+    }
+
+    SECTION("bson")
+    {
+        std::vector<uint8_t> data;
+        bson::encode_bson(val, data);
+        check(bson::decode_bson<shape>(data));
+    }
+
+    SECTION("ubjson")
+    {
+        std::vector<uint8_t> data;
+        ubjson::encode_ubjson(val, data);
+        check(ubjson::decode_ubjson<shape>(data));
+    }
+}
+
+TEST_CASE("ser_traits encodes structs to a content handler")
+{
+    SECTION("members sorted by name, or in declaration order for ojson")
+    {
+        shape val;
+        val.name = "square";
+        val.points = {{0,0},{1,1}};
+        val.attributes["weight"] = 2.5;
+        val.closed = true;
+
+        std::string s1;
+        encode_json(val, s1);
+        CHECK(s1 == R"({"attributes":{"weight":2.5},"closed":true,"name":"square","points":[{"x":0,"y":0},{"x":1,"y":1}]})");
+        CHECK(s1 == json(val).to_string());
+
+        std::string s2;
+        encode_json(ojson(), val, s2);
+        CHECK(s2 == R"({"name":"square","points":[{"x":0,"y":0},{"x":1,"y":1}],"attributes":{"weight":2.5},"closed":true})");
+        CHECK(s2 == ojson(val).to_string());
+    }
+
+    SECTION("named members, getters and setters")
+    {
+        named_point np{1,2};
+        std::string s1;
+        encode_json(np, s1);
+        CHECK(s1 == R"({"X":1,"Y":2})");
+
+        segment seg(fixed_point(1,2), fixed_point(3,4), "a");
+        std::string s2;
+        encode_json(seg, s2);
+        CHECK(s2 == R"({"From":{"x":1,"y":2},"Label":"a","To":{"x":3,"y":4}})");
+
+        settable_point sp;
+        sp.set_x(5);
+        std::string s3;
+        encode_json(sp, s3);
+        CHECK(s3 == R"({"x":5,"y":0})");
+    }
+
+    SECTION("wide characters")
+    {
+        std::vector<point> v = {{1,-2}};
+        std::wstring s;
+        encode_json(v, s);
+        CHECK(s == LR"([{"x":1,"y":-2}])");
+    }
+}
+
+TEST_CASE("ser_traits member and enum dispatch")
+{
+    SECTION("names that are prefixes of one another")
+    {
+        prefixes val = decode_json<prefixes>(std::string(R"({"abcd":9,"abc":3,"":9,"b":4,"ab":2,"a":1,"ba":9})"));
+        CHECK(val.a == 1);
+        CHECK(val.ab == 2);
+        CHECK(val.abc == 3);
+        CHECK(val.b == 4);
+    }
+
+    SECTION("enums")
+    {
+        item val = decode_json<item>(std::string(R"({"c":"blue","s":"L","palette":["green","red",""]})"));
+        CHECK(val.c == color::blue);
+        CHECK(val.s == size::large);
+        REQUIRE(val.palette.size() == 3);
+        CHECK(val.palette[0] == color::green);
+        CHECK(val.palette[1] == color::red);
+        CHECK(val.palette[2] == color::red);
+
+        std::string s;
+        encode_json(val, s);
+        CHECK(s == R"({"c":"blue","palette":["green","red","red"],"s":"L"})");
+
+        CHECK_THROWS_AS(decode_json<color>(std::string(R"("purple")")), json_runtime_error<std::runtime_error>);
+        CHECK_THROWS_AS(decode_json<color>(std::string("1")), json_runtime_error<std::runtime_error>);
+        CHECK_THROWS_AS(encode_json(static_cast<color>(7), s), json_runtime_error<std::runtime_error>);
+    }
+
+    SECTION("wide characters")
+    {
+        item val = decode_json<item>(std::wstring(LR"({"c":"green","s":"S"})"));
+        CHECK(val.c == color::green);
+        CHECK(val.s == size::small);
+
+        std::wstring s;
+        encode_json(val, s);
+        CHECK(s == LR"({"c":"green","palette":[],"s":"S"})");
+    }
+}
+
+TEST_CASE("ser_traits decodes into an existing value")
+{
+    SECTION("vectors grow and shrink in place")
+    {
+        std::vector<point> v;
+        decode_json_into(v, std::string(R"([{"x":1,"y":2},{"x":3,"y":4},{"x":5,"y":6}])"));
+        REQUIRE(v.size() == 3);
+        const point* data = v.data();
+
+        decode_json_into(v, std::string(R"([{"x":7},{"y":8}])"));
+        REQUIRE(v.size() == 2);
+        CHECK(v.data() == data);
+        CHECK(v[0].x == 7);
+        CHECK(v[0].y == 0);
+        CHECK(v[1].x == 0);
+        CHECK(v[1].y == 8);
+
+        decode_json_into(v, std::string(R"([{"x":1},{"x":2},{"x":3},{"x":4}])"));
+        REQUIRE(v.size() == 4);
+        CHECK(v[3].x == 4);
+
+        std::vector<bool> bits = {true, true, true};
+        decode_json_into(bits, std::string("[false,true]"));
+        CHECK(bits == std::vector<bool>({false, true}));
+    }
+
+    SECTION("strings keep their capacity")
+    {
+        shape val;
+        decode_json_into(val, std::string(R"({"name":"a somewhat longer name than fits in place","closed":true})"));
+        const char* data = val.name.data();
+        decode_json_into(val, std::string(R"({"name":"short"})"));
+        CHECK(val.name == "short");
+        CHECK(val.name.data() == data);
+        CHECK_FALSE(val.closed);
+    }
+
+    SECTION("maps reuse nodes and drop keys that were not read")
+    {
+        std::map<std::string,std::vector<int>> m;
+        decode_json_into(m, std::string(R"({"a":[1,2,3],"b":[4],"c":[]})"));
+        REQUIRE(m.size() == 3);
+        const std::vector<int>* a = &m["a"];
+        const int* a_data = m["a"].data();
+
+        decode_json_into(m, std::string(R"({"d":[5],"a":[6,7],"d":[8]})"));
+        REQUIRE(m.size() == 2);
+#if defined(__cpp_lib_node_extract)
+        CHECK(&m["a"] == a);
+#else
+        (void)a;
+#endif
+        CHECK(m["a"].data() == a_data);
+        CHECK(m["a"] == std::vector<int>({6,7}));
+        CHECK(m["d"] == std::vector<int>({5}));
+        CHECK(m.count("b") == 0);
+
+        std::unordered_map<std::string,std::string> um = {{"a","a value longer than fits in place"},{"b","b"}};
+        const char* um_data = um["a"].data();
+        decode_json_into(um, std::string(R"({"c":"c","a":"another value","a":"x"})"));
+        REQUIRE(um.size() == 2);
+        CHECK(um["a"] == "another value");
+        CHECK(um["a"].data() == um_data);
+        CHECK(um["c"] == "c");
+    }
+
+    SECTION("members not read are reset")
+    {
+        shape val;
+        decode_json_into(val, std::string(R"({"name":"square","points":[{"x":1,"y":1}],"attributes":{"weight":2.5},"closed":true})"));
+        decode_json_into(val, std::string(R"({"points":[{"x":2}]})"));
+        CHECK(val.name.empty());
+        REQUIRE(val.points.size() == 1);
+        CHECK(val.points[0].x == 2);
+        CHECK(val.points[0].y == 0);
+        CHECK(val.attributes.empty());
+        CHECK_FALSE(val.closed);
+
+        named_point np{5,6};
+        decode_json_into(np, std::string(R"({"Y":2})"));
+        CHECK(np.x == 0);
+        CHECK(np.y == 2);
+
+        settable_point sp;
+        sp.set_x(5);
+        decode_json_into(sp, std::string(R"({"y":2})"));
+        CHECK(sp.get_x() == 0);
+        CHECK(sp.get_y() == 2);
+
+        segment seg(fixed_point(1,2), fixed_point(3,4), "a");
+        decode_json_into(seg, std::string(R"({"From":{"x":5,"y":6},"To":{"x":7,"y":8},"Label":"b"})"));
+        CHECK(seg.from().x() == 5);
+        CHECK(seg.label() == "b");
+
+        CHECK_THROWS_AS(decode_json_into(val, std::string(R"({"name":})")), ser_error);
+    }
+
+    SECTION("arrays and streams")
+    {
+        std::array<int,3> arr = {{1,2,3}};
+        std::istringstream is("[4,5]");
+        decode_json_into(arr, is);
+        CHECK(arr[0] == 4);
+        CHECK(arr[1] == 5);
+        CHECK(arr[2] == 0);
+
+        json j;
+        decode_json_into(j, std::string(R"({"a":1})"));
+        CHECK(j["a"] == 1);
+    }
+}
@@ -14,7 +14,21 @@
 #include <ctime>
 #include <catch/catch.hpp>
 
+namespace staj_iterator_tests {
+
+    struct student
+    {
+        int enrollmentNo;
+        std::string firstName;
+        std::vector<int> marks;
+    };
+
+} // namespace staj_iterator_tests
+
+JSONCONS_MEMBER_TRAITS_DECL(staj_iterator_tests::student, enrollmentNo, firstName, marks)
+
 using namespace jsoncons;
+using staj_iterator_tests::student;
 
 TEST_CASE("array_iterator test")
 {
@@ -92,3 +106,113 @@ TEST_CASE("object_iterator test")
 
 
 
+
+TEST_CASE("typed iterators reuse element storage")
+{
+    SECTION("array of structs")
+    {
+        std::string s = R"(
+        [
+            {"enrollmentNo":100,"firstName":"A name too long for small strings","marks":[55,60,65]},
+            {"enrollmentNo":101,"firstName":"Catherine","marks":[95]},
+            {"firstName":"William"}
+        ]
+        )";
+
+        json_cursor cursor(s);
+        auto it = make_array_iterator<student>(cursor);
+        auto end = jsoncons::end(it);
+
+        REQUIRE((it != end));
+        const student* first = &*it;
+        const char* name = it->firstName.data();
+        const int* marks = it->marks.data();
+        CHECK(it->enrollmentNo == 100);
+
+        ++it;
+        REQUIRE((it != end));
+        CHECK(&*it == first);
+        CHECK(it->enrollmentNo == 101);
+        CHECK(it->firstName == "Catherine");
+        CHECK(it->firstName.data() == name);
+        CHECK(it->marks == std::vector<int>({95}));
+        CHECK(it->marks.data() == marks);
+
+        std::error_code ec;
+        it.increment(ec);
+        REQUIRE_FALSE(ec);
+        REQUIRE((it != end));
+        CHECK(it->enrollmentNo == 0);
+        CHECK(it->firstName == "William");
+        CHECK(it->marks.empty());
+
+        ++it;
+        CHECK((it == end));
+    }
+
+    SECTION("object of vectors")
+    {
+        std::string s = R"({"first":[1,2,3,4],"second":[5],"third":[]})";
+
+        json_cursor cursor(s);
+        auto it = make_object_iterator<std::vector<int>>(cursor);
+        auto end = jsoncons::end(it);
+
+        REQUIRE((it != end));
+        CHECK(it->first == "first");
+        const int* data = it->second.data();
+
+        ++it;
+        REQUIRE((it != end));
+        CHECK(it->first == "second");
+        CHECK(it->second == std::vector<int>({5}));
+        CHECK(it->second.data() == data);
+
+        auto copy = it;
+        ++it;
+        REQUIRE((it != end));
+        CHECK(it->first == "third");
+        CHECK(it->second.empty());
+        CHECK(copy->first == "second");
+        CHECK(copy->second == std::vector<int>({5}));
+
+        auto moved = std::move(it);
+        ++moved;
+        CHECK((moved == end));
+    }
+}
+
+TEST_CASE("typed iterators move and assign to themselves")
+{
+    static_assert(std::is_nothrow_move_constructible<staj_array_iterator<json,std::vector<int>>>::value, "");
+    static_assert(std::is_nothrow_move_assignable<staj_object_iterator<json,std::string>>::value, "");
+
+    SECTION("array")
+    {
+        std::string s = "[[1,2],[3]]";
+        json_cursor cursor(s);
+        auto it = make_array_iterator<std::vector<int>>(cursor);
+        auto& self = it;
+        it = std::move(self);
+        CHECK(*it == std::vector<int>({1,2}));
+        it = self;
+        CHECK(*it == std::vector<int>({1,2}));
+        ++it;
+        CHECK(*it == std::vector<int>({3}));
+    }
+
+    SECTION("object")
+    {
+        std::string s = R"({"a":"a value longer than fits in place","b":"b"})";
+        json_cursor cursor(s);
+        auto it = make_object_iterator<std::string>(cursor);
+        auto& self = it;
+        it = std::move(self);
+        CHECK(it->first == "a");
+        CHECK(it->second == "a value longer than fits in place");
+        it = self;
+        CHECK(it->second == "a value longer than fits in place");
+        ++it;
+        CHECK(it->second == "b");
+    }
+}
@@ -0,0 +1,108 @@
+// Copyright 2019 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/string_pool.hpp>
+#include <jsoncons/detail/hash.hpp>
+#include <catch/catch.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    json decode(const std::string& input, string_pool& pool, size_t max_length = 64)
+    {
+        json_decoder<json> decoder;
+        decoder.intern_strings(pool, max_length);
+        json_parser parser;
+        parser.update(input.data(), input.size());
+        parser.parse_some(decoder);
+        parser.finish_parse(decoder);
+        parser.check_done();
+        return decoder.get_result();
+    }
+}
+
+TEST_CASE("test_string_pool_intern")
+{
+    string_pool pool(32);
+
+    std::string s1 = "Toronto";
+    std::string s2 = "Toronto";
+    auto v1 = pool.intern(s1);
+    auto v2 = pool.intern(s2);
+    CHECK(v1.data() == v2.data());
+    CHECK(v1.data() != s1.data());
+    CHECK(v1 == string_view("Toronto"));
+    CHECK(v1.data()[v1.length()] == 0);
+
+    std::string long_string(100, 'x');
+    auto v3 = pool.intern(long_string);
+    CHECK(v3 == string_view(long_string));
+    CHECK(pool.intern(string_view()).empty());
+
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        pool.intern(std::to_string(i % 100));
+    }
+    CHECK(pool.intern(s1).data() == v1.data());
+    CHECK(pool.size() == 103);
+    CHECK(pool.lookups() == 1005);
+    CHECK(pool.hits() == 902);
+    CHECK(pool.hit_rate() == Approx(902.0/1005.0));
+
+    pool.reset_statistics();
+    CHECK(pool.lookups() == 0);
+    CHECK(pool.size() == 103);
+
+    pool.clear();
+    CHECK(pool.size() == 0);
+    CHECK(pool.length() == 0);
+}
+
+TEST_CASE("test_json_decoder_intern_strings")
+{
+    string_pool pool;
+
+    std::string input1 = R"([{"status":"Shipped to customer","country":"Canada","note":"A note that is longer than the limit"},{"status":"Shipped to customer","country":"Canada"}])";
+    std::string input2 = R"({"status":"Shipped to customer"})";
+
+    json j1 = decode(input1, pool, 32);
+    json j2 = decode(input2, pool, 32);
+
+    CHECK(j1[0]["status"].type() == storage_type::borrowed_string_value);
+    CHECK(j1[0]["status"].as_string_view().data() == j1[1]["status"].as_string_view().data());
+    CHECK(j2["status"].as_string_view().data() == j1[0]["status"].as_string_view().data());
+
+    // Short strings stay inline, long ones are copied
+    CHECK(j1[0]["country"].type() == storage_type::short_string_value);
+    CHECK(j1[0]["note"].type() == storage_type::long_string_value);
+
+    // The names status, country and note, and one string value
+    CHECK(pool.size() == 4);
+    CHECK(pool.lookups() == 9);
+    CHECK(pool.hits() == 5);
+
+    CHECK(j1 == json::parse(input1));
+
+    json copy = j1;
+    copy.detach();
+    CHECK(copy[0]["status"].type() == storage_type::long_string_value);
+    CHECK(copy == j1);
+}
+
+TEST_CASE("test_fnv1a_hash_bytes")
+{
+    // Characters with the high bit set hash as the same bytes whether char is signed or not
+    const char s[] = "caf\xc3\xa9";
+    const uint8_t bytes[] = {'c','a','f',0xc3,0xa9};
+    CHECK(jsoncons::detail::fnv1a_hash(s, 5) == jsoncons::detail::fnv1a_hash(bytes, 5));
+
+    const signed char sc[] = {'c','a','f',static_cast<signed char>(-61),static_cast<signed char>(-87)};
+    CHECK(jsoncons::detail::fnv1a_hash(sc, 5) == jsoncons::detail::fnv1a_hash(bytes, 5));
+}
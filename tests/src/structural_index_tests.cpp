@@ -0,0 +1,180 @@
+// Copyright 2019 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/detail/structural_index.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <vector>
+#include <utility>
+
+using namespace jsoncons;
+
+namespace {
+
+    struct chunked_parse_result
+    {
+        json value;
+        std::error_code ec;
+        size_t line;
+        size_t column;
+    };
+
+    chunked_parse_result parse_in_chunks(const std::string& input, size_t chunk_size, bool structural_index)
+    {
+        json_options options;
+        options.structural_index(structural_index);
+
+        json_decoder<json> decoder;
+        json_parser parser(options, strict_json_parsing());
+
+        chunked_parse_result result;
+        size_t offset = 0;
+        while (!parser.finished())
+        {
+            if (parser.source_exhausted() && offset < input.size())
+            {
+                size_t length = (std::min)(chunk_size, input.size() - offset);
+                parser.update(input.data() + offset, length);
+                offset += length;
+            }
+            parser.parse_some(decoder, result.ec);
+            if (result.ec)
+            {
+                break;
+            }
+        }
+        result.line = parser.line();
+        result.column = parser.column();
+        if (!result.ec)
+        {
+            result.value = decoder.get_result();
+        }
+        return result;
+    }
+
+    void check_same_as_default(const std::string& input)
+    {
+        std::vector<size_t> chunk_sizes = {1, 2, 3, 7, 63, 64, 65, 4096};
+        for (auto chunk_size : chunk_sizes)
+        {
+            chunked_parse_result expected = parse_in_chunks(input, chunk_size, false);
+            chunked_parse_result actual = parse_in_chunks(input, chunk_size, true);
+
+            CHECK(actual.ec == expected.ec);
+            CHECK(actual.line == expected.line);
+            CHECK(actual.column == expected.column);
+            if (!expected.ec)
+            {
+                CHECK(actual.value == expected.value);
+            }
+        }
+    }
+}
+
+TEST_CASE("structural_index classification")
+{
+    std::string input = "  \"a\\\"b\"\r\n\t[1,\x01]";
+    jsoncons::detail::basic_structural_index<char> index;
+    index.update(input.data(), input.size());
+
+    SECTION("find_string_special")
+    {
+        const char* p = index.find_string_special(input.data());
+        CHECK(p == input.data() + 2);
+        p = index.find_string_special(p + 1);
+        CHECK(p == input.data() + 4);
+        p = index.find_string_special(input.data() + input.size() - 2);
+        CHECK(p == input.data() + input.size() - 2);
+    }
+
+    SECTION("skip_whitespace")
+    {
+        size_t line = 1;
+        size_t column = 1;
+        const char* p = index.skip_whitespace(input.data(), line, column);
+        CHECK(p == input.data() + 2);
+        CHECK(line == 1);
+        CHECK(column == 3);
+
+        p = index.skip_whitespace(input.data() + 8, line, column);
+        CHECK(p == input.data() + 11);
+        CHECK(line == 2);
+        CHECK(column == 2);
+    }
+}
+
+TEST_CASE("structural_index long runs")
+{
+    std::string spaces(200, ' ');
+    std::string text(300, 'x');
+
+    std::string input = "[" + spaces + "\"" + text + "\"," + spaces + "\n" + spaces + "\"" + text + "\\n" + text + "\"\r\n" + spaces + "]";
+    check_same_as_default(input);
+}
+
+TEST_CASE("structural_index matches default parsing")
+{
+    SECTION("pretty printed")
+    {
+        json j = json::parse(R"(
+        {
+            "store": {
+                "book": [
+                    {"category": "reference", "author": "Nigel Rees", "title": "Sayings of the Century", "price": 8.95},
+                    {"category": "fiction", "author": "Evelyn Waugh", "title": "Sword of Honour", "price": 12.99, "isbn": "0-553-21311-3"}
+                ],
+                "bicycle": {"color": "red", "price": 19.95, "ids" : [1, -2, 18446744073709551616, true, false, null]}
+            }
+        }
+        )");
+        std::ostringstream os;
+        os << pretty_print(j);
+        check_same_as_default(os.str());
+    }
+
+    SECTION("escapes and surrogate pairs")
+    {
+        check_same_as_default("[\"\\u00e9t\\u00e9\", \"\\uD834\\uDD1E\", \"tab\\tquote\\\"backslash\\\\\"]");
+    }
+
+    SECTION("windows line endings")
+    {
+        check_same_as_default("{\r\n  \"a\" : 1,\r\n  \"b\" : [\r\n    2,\r\r\n    3\r\n  ]\r\n}\r\n");
+    }
+}
+
+TEST_CASE("structural_index reports errors at the same position")
+{
+    SECTION("control character in string")
+    {
+        check_same_as_default("[\n    \"abc\x01\"]");
+    }
+    SECTION("newline in string")
+    {
+        check_same_as_default("[\r\n    \"abc\ndef\"]");
+    }
+    SECTION("missing comma")
+    {
+        check_same_as_default("{\n  \"a\" : 1\n      \n  \"b\" : 2\n}");
+    }
+    SECTION("unexpected eof")
+    {
+        check_same_as_default("[1, 2,    \n   ");
+    }
+}
+
+TEST_CASE("structural_index with json_reader")
+{
+    std::string input = R"({"first" : "Jane",   "last" : "Roe",   "events" : [1,   2,   3]})";
+
+    json_options options;
+    options.structural_index(true);
+
+    std::istringstream is(input);
+    json j = json::parse(is, options);
+
+    CHECK(j == json::parse(input));
+}